@@ -0,0 +1,66 @@
+#ifndef BENCH_TIMER_H
+#define BENCH_TIMER_H
+
+#include <Arduino.h>
+
+// Chronomètre du banc de mesure.
+// AVR : Timer1 sans prédiviseur, un tic par cycle CPU, étendu à 32 bits par son débordement.
+// Hôte : horloge monotone en nanosecondes.
+
+#ifdef __AVR__
+
+#include <avr/interrupt.h>
+
+static volatile uint16_t benchTimerOverflows = 0;
+
+ISR(TIMER1_OVF_vect) {
+    benchTimerOverflows++;
+}
+
+inline void benchTimerBegin() {
+    TCCR1A = 0;
+    TCCR1B = _BV(CS10);     // Horloge CPU, pas de prédiviseur
+    TCNT1 = 0;
+    TIFR1 = _BV(TOV1);
+    TIMSK1 = _BV(TOIE1);
+}
+
+// Cycles CPU écoulés depuis benchTimerBegin()
+inline uint32_t benchTicks() {
+    uint8_t sreg = SREG;
+    cli();
+    uint16_t low = TCNT1;
+    uint16_t high = benchTimerOverflows;
+    // Débordement survenu pendant la lecture mais pas encore compté
+    if ((TIFR1 & _BV(TOV1)) && low < 0x8000) {
+        high++;
+    }
+    SREG = sreg;
+    return ((uint32_t)high << 16) | low;
+}
+
+// Conversion des tics en microsecondes
+inline float benchTicksToMicros(uint32_t ticks) {
+    return ticks / (F_CPU / 1000000.0f);
+}
+
+#else
+
+#include <time.h>
+
+inline void benchTimerBegin() {}
+
+// Nanosecondes de l'horloge monotone (tronquées à 32 bits : mesures de moins de 4 s)
+inline uint32_t benchTicks() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+inline float benchTicksToMicros(uint32_t ticks) {
+    return ticks / 1000.0f;
+}
+
+#endif
+
+#endif // BENCH_TIMER_H
\ No newline at end of file
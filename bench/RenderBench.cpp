@@ -0,0 +1,160 @@
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "LedConfig.h"
+#include "OffMode.h"
+#include "WhiteMode.h"
+#include "BlueFlickerMode.h"
+#include "FlameMode.h"
+#include "GradientMode.h"
+#include "FireMode.h"
+#include "ModeRegistry.h"
+#include "BenchTimer.h"
+
+// Banc de mesure de render() : chaque mode, pour chaque valeur du paramètre global, est rendu
+// BENCH_SAMPLES fois sur une horloge fictive. show() n'est jamais appelé : seul le calcul de
+// la trame est mesuré. La longueur de bande est celle de la compilation (LED_COUNT) ;
+// le balayage des longueurs se fait par une compilation par longueur (voir bench/README).
+//
+// Sortie CSV sur le port série (lignes de commentaire préfixées par '#') :
+// mode,leds,param,samples,min_us,median_us,max_us,median_us_per_led
+
+#define BENCH_PIN 6
+#define BENCH_FRAME_MS 20   // Durée de trame simulée (50 FPS)
+
+#ifdef __AVR__
+#define BENCH_SAMPLES 32
+#define BENCH_TARGET "avr"
+#else
+#define BENCH_SAMPLES 256
+#define BENCH_TARGET "native"
+#endif
+
+static const float benchParams[] = {0.0, 50.0, 100.0};
+static const float benchFullParam = 50.0;   // Lignes "<mode>_full" : paramètre alterné entre 50 et 51
+typedef ModeRegistry<OffMode, WhiteMode, BlueFlickerMode, FlameMode, GradientMode, FireMode> BenchModes;
+static const uint8_t benchModeCount = BenchModes::count;
+static const char* const benchModeNames[benchModeCount] = {"off", "white", "blueflicker", "flame", "gradient", "fire"};
+
+static uint32_t samples[BENCH_SAMPLES];
+static uint32_t timerOverhead = 0;
+static ParameterBank benchParameters;
+
+static Adafruit_NeoPixel strip(LED_COUNT, BENCH_PIN, LED_TYPE);
+static BenchModes modes(&strip, &benchParameters);
+static_assert(LED_RAM_FITS(BenchModes::storageSize, sizeof(samples) + sizeof(strip) + sizeof(benchParameters) +
+                           (sizeof(modes) - BenchModes::storageSize)),
+              "LED_COUNT trop grand : bande, mode actif et globales dépassent le budget RAM");
+
+static void sortSamples(uint16_t count) {
+    // Tri par insertion : quelques dizaines d'échantillons
+    for (uint16_t i = 1; i < count; i++) {
+        uint32_t value = samples[i];
+        uint16_t j = i;
+        while (j > 0 && samples[j - 1] > value) {
+            samples[j] = samples[j - 1];
+            j--;
+        }
+        samples[j] = value;
+    }
+}
+
+// Coût d'une mesure à vide, retiré de chaque échantillon
+static void calibrateTimer() {
+    timerOverhead = 0xFFFFFFFFUL;
+    for (uint8_t i = 0; i < 16; i++) {
+        uint32_t start = benchTicks();
+        uint32_t elapsed = benchTicks() - start;
+        if (elapsed < timerOverhead) {
+            timerOverhead = elapsed;
+        }
+    }
+}
+
+// fullRender : paramètre modifié (hors mesure) avant chaque trame, aucune trame ne peut être sautée
+static void runCase(uint8_t modeIndex, float parameter, bool fullRender) {
+    benchParameters.set(PARAM_GLOBAL, parameter);
+    LightingMode* mode = modes.activate(modeIndex);
+    unsigned long now = 0;
+
+    // Trame de chauffe : construction des profils hors mesure
+    mode->render(now, BENCH_FRAME_MS);
+
+    for (uint16_t i = 0; i < BENCH_SAMPLES; i++) {
+        now += BENCH_FRAME_MS;
+        if (fullRender) {
+            benchParameters.set(PARAM_GLOBAL, parameter + ((i & 1) ? 0.0 : 1.0));
+        }
+        uint32_t start = benchTicks();
+        mode->render(now, BENCH_FRAME_MS);
+        uint32_t elapsed = benchTicks() - start;
+        samples[i] = elapsed > timerOverhead ? elapsed - timerOverhead : 0;
+    }
+
+    sortSamples(BENCH_SAMPLES);
+    float minUs = benchTicksToMicros(samples[0]);
+    float medianUs = benchTicksToMicros(samples[BENCH_SAMPLES / 2]);
+    float maxUs = benchTicksToMicros(samples[BENCH_SAMPLES - 1]);
+
+    Serial.print(benchModeNames[modeIndex]);
+    if (fullRender) {
+        Serial.print("_full");
+    }
+    Serial.print(',');
+    Serial.print((unsigned int)LED_COUNT);
+    Serial.print(',');
+    Serial.print((int)parameter);
+    Serial.print(',');
+    Serial.print((unsigned int)BENCH_SAMPLES);
+    Serial.print(',');
+    Serial.print(minUs, 2);
+    Serial.print(',');
+    Serial.print(medianUs, 2);
+    Serial.print(',');
+    Serial.print(maxUs, 2);
+    Serial.print(',');
+    Serial.println(medianUs / LED_COUNT, 4);
+}
+
+void setup() {
+    Serial.begin(115200);
+    benchTimerBegin();
+    calibrateTimer();
+
+    Serial.print("# render bench target=");
+    Serial.print(BENCH_TARGET);
+    Serial.print(" frame_ms=");
+    Serial.print(BENCH_FRAME_MS);
+    Serial.print(" samples=");
+    Serial.println(BENCH_SAMPLES);
+
+    // Empreinte de chaque mode pour LED_COUNT LEDs (profils compris)
+    for (uint8_t m = 0; m < benchModeCount; m++) {
+        Serial.print("# footprint mode=");
+        Serial.print(benchModeNames[m]);
+        Serial.print(" bytes=");
+        Serial.println((unsigned int)BenchModes::footprint(m));
+    }
+    Serial.print("# footprint storage bytes=");
+    Serial.println((unsigned int)BenchModes::storageSize);
+
+    Serial.println("mode,leds,param,samples,min_us,median_us,max_us,median_us_per_led");
+
+    for (uint8_t m = 0; m < benchModeCount; m++) {
+        for (uint8_t p = 0; p < sizeof(benchParams) / sizeof(benchParams[0]); p++) {
+            runCase(m, benchParams[p], false);
+        }
+        runCase(m, benchFullParam, true);
+    }
+    Serial.println("# done");
+}
+
+void loop() {
+}
+
+#ifndef __AVR__
+// Sur l'hôte, le banc s'exécute une fois sans la boucle de simulation de sim/src/SimMain.cpp
+int main() {
+    setup();
+    return 0;
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,80 @@
+#ifndef SIM_ADAFRUIT_NEOPIXEL_H
+#define SIM_ADAFRUIT_NEOPIXEL_H
+
+// Substitut hôte de Adafruit_NeoPixel : même tampon, mêmes conversions de couleur.
+// show() transmet la trame à l'hôte de simulation (compteur, horloge virtuelle, export).
+
+#include <Arduino.h>
+
+typedef uint16_t neoPixelType;
+
+// Ordre des couleurs : décalages W, R, G, B encodés comme dans la bibliothèque
+#define NEO_RGB  ((0 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_RBG  ((0 << 6) | (0 << 4) | (2 << 2) | (1))
+#define NEO_GRB  ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_GBR  ((2 << 6) | (2 << 4) | (0 << 2) | (1))
+#define NEO_BRG  ((1 << 6) | (1 << 4) | (2 << 2) | (0))
+#define NEO_BGR  ((2 << 6) | (2 << 4) | (1 << 2) | (0))
+#define NEO_WRGB ((0 << 6) | (1 << 4) | (2 << 2) | (3))
+#define NEO_RGBW ((3 << 6) | (0 << 4) | (1 << 2) | (2))
+#define NEO_GRBW ((3 << 6) | (1 << 4) | (0 << 2) | (2))
+
+#define NEO_KHZ800 0x0000
+#define NEO_KHZ400 0x0100
+
+class Adafruit_NeoPixel {
+public:
+    Adafruit_NeoPixel(uint16_t n, int16_t pin = 6, neoPixelType type = NEO_GRB + NEO_KHZ800);
+    Adafruit_NeoPixel();
+    ~Adafruit_NeoPixel();
+
+    void begin() { begun = true; }
+    void show();
+    void setPin(int16_t p) { pin = p; }
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+    void setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w);
+    void setPixelColor(uint16_t n, uint32_t c);
+    void fill(uint32_t c = 0, uint16_t first = 0, uint16_t count = 0);
+    void setBrightness(uint8_t b);
+    void clear();
+    void updateLength(uint16_t n);
+    void updateType(neoPixelType t);
+    bool canShow() { return true; }
+
+    uint8_t* getPixels() const { return pixels; }
+    uint8_t getBrightness() const { return brightness - 1; }
+    int16_t getPin() const { return pin; }
+    uint16_t numPixels() const { return numLEDs; }
+    uint32_t getPixelColor(uint16_t n) const;
+
+    // Décalages de couleur (accès réservé à la simulation)
+    uint8_t redOffset() const { return rOffset; }
+    uint8_t greenOffset() const { return gOffset; }
+    uint8_t blueOffset() const { return bOffset; }
+    uint8_t bytesPerPixel() const { return wOffset == rOffset ? 3 : 4; }
+
+    static uint8_t sine8(uint8_t x);
+    static uint8_t gamma8(uint8_t x);
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    static uint32_t Color(uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+        return ((uint32_t)w << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    static uint32_t ColorHSV(uint16_t hue, uint8_t sat = 255, uint8_t val = 255);
+    static uint32_t gamma32(uint32_t x);
+
+protected:
+    bool begun;
+    uint16_t numLEDs;
+    uint16_t numBytes;
+    int16_t pin;
+    uint8_t brightness;
+    uint8_t* pixels;
+    uint8_t rOffset;
+    uint8_t gOffset;
+    uint8_t bOffset;
+    uint8_t wOffset;
+};
+
+#endif // SIM_ADAFRUIT_NEOPIXEL_H
@@ -0,0 +1,116 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Substitut hôte de Arduino.h pour l'environnement [env:native].
+// Seule la partie de l'API utilisée par le firmware est fournie.
+// Attention : sur l'hôte, unsigned long fait 64 bits, millis() ne reboucle donc jamais.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+#include <type_traits>
+
+#include "avr/pgmspace.h"
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT        0x0
+#define OUTPUT       0x1
+#define INPUT_PULLUP 0x2
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define PI      3.1415926535897932384626433832795
+#define HALF_PI 1.5707963267948966192313216916398
+#define TWO_PI  6.283185307179586476925286766559
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// min/max/constrain sont des macros sur AVR ; des modèles évitent les conflits avec la STL
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type min(A a, B b) { return a < b ? a : b; }
+
+template <typename A, typename B>
+inline typename std::common_type<A, B>::type max(A a, B b) { return a > b ? a : b; }
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+#define F(string_literal) (string_literal)
+
+#define digitalPinToInterrupt(p) ((p) == 2 ? 0 : ((p) == 3 ? 1 : -1))
+
+// Temps (horloge virtuelle, voir SimHost.h)
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+// Entrées/sorties numériques (niveaux pilotés par le script de boutons)
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+// Interruptions
+void attachInterrupt(uint8_t interruptNumber, void (*isr)(void), int mode);
+void detachInterrupt(uint8_t interruptNumber);
+void noInterrupts();
+void interrupts();
+
+// Nombres pseudo-aléatoires (même suite que avr-libc)
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+
+// Point d'entrée du croquis
+void setup();
+void loop();
+
+// Port série : écrit sur la sortie standard (désactivable, voir SimHost.h). L'émission est
+// immédiate : le tampon paraît toujours vide, comme sur la cible une fois les octets partis.
+#define SERIAL_TX_BUFFER_SIZE 64
+
+class HardwareSerial {
+public:
+    void begin(unsigned long baud);
+    void end() {}
+    int available() { return 0; }
+    int read() { return -1; }
+    int availableForWrite() { return SERIAL_TX_BUFFER_SIZE - 1; }
+    void flush() {}
+
+    size_t write(uint8_t c);
+    size_t write(const uint8_t* buffer, size_t size);
+
+    size_t print(const char* text);
+    size_t print(char c);
+    size_t print(int value, int base = DEC);
+    size_t print(unsigned int value, int base = DEC);
+    size_t print(long value, int base = DEC);
+    size_t print(unsigned long value, int base = DEC);
+    size_t print(double value, int digits = 2);
+
+    size_t println();
+    size_t println(const char* text);
+    size_t println(char c);
+    size_t println(int value, int base = DEC);
+    size_t println(unsigned int value, int base = DEC);
+    size_t println(long value, int base = DEC);
+    size_t println(unsigned long value, int base = DEC);
+    size_t println(double value, int digits = 2);
+
+    operator bool() { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,47 @@
+#ifndef SIM_HOST_H
+#define SIM_HOST_H
+
+// Contrôle de l'environnement simulé : horloge virtuelle, broches, export des trames.
+
+#include <stdint.h>
+#include <stdio.h>
+
+class Adafruit_NeoPixel;
+
+// Horloge virtuelle en microsecondes
+uint64_t simTimeMicros();
+void simSetTimeMicros(uint64_t us);
+void simAdvanceMicros(uint64_t us);
+
+// Mise en veille du firmware : avance l'horloge jusqu'à wakeMicros, ou jusqu'au prochain
+// changement de broche programmé s'il arrive avant (réveil par interruption).
+// Retourne true si le réveil vient d'un changement de broche.
+bool simSleepUntil(uint64_t wakeMicros);
+
+// Vrai si le firmware a dormi depuis l'appel précédent (la boucle de simulation n'ajoute
+// alors pas son pas d'horloge : le sommeil a déjà consommé le temps)
+bool simTakeSleep();
+
+// Instant du prochain changement de broche programmé (UINT64_MAX : aucun), fixé par la boucle de simulation
+void simSetNextPinEvent(uint64_t timeMicros);
+
+// Niveau lu par digitalRead() sur une broche (HIGH par défaut : bouton en pull-up relâché).
+// Déclenche l'interruption attachée à la broche si le niveau change.
+void simSetPin(uint8_t pin, int level);
+
+// show() fait avancer l'horloge de la durée de transfert WS2812 (actif par défaut)
+void simSetShowTimeModel(bool enabled);
+
+// Export des trames envoyées : une ligne "millis RRGGBB RRGGBB ..." par show()
+void simSetFrameDump(FILE* file);
+
+// Écho du port série sur la sortie standard (actif par défaut)
+void simSetSerialEcho(bool enabled);
+
+// Nombre d'appels à show() depuis le démarrage
+unsigned long simShowCount();
+
+// Appelé par le substitut Adafruit_NeoPixel à chaque show()
+void simOnShow(const Adafruit_NeoPixel& strip);
+
+#endif // SIM_HOST_H
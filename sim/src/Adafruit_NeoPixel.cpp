@@ -0,0 +1,201 @@
+#include <Adafruit_NeoPixel.h>
+#include "SimHost.h"
+
+Adafruit_NeoPixel::Adafruit_NeoPixel(uint16_t n, int16_t p, neoPixelType t)
+    : begun(false), numLEDs(0), numBytes(0), pin(p), brightness(0), pixels(NULL),
+      rOffset(1), gOffset(0), bOffset(2), wOffset(1) {
+    updateType(t);
+    updateLength(n);
+}
+
+Adafruit_NeoPixel::Adafruit_NeoPixel()
+    : begun(false), numLEDs(0), numBytes(0), pin(-1), brightness(0), pixels(NULL),
+      rOffset(1), gOffset(0), bOffset(2), wOffset(1) {
+    updateType(NEO_GRB + NEO_KHZ800);
+}
+
+Adafruit_NeoPixel::~Adafruit_NeoPixel() {
+    free(pixels);
+}
+
+void Adafruit_NeoPixel::updateLength(uint16_t n) {
+    free(pixels);
+    numBytes = n * bytesPerPixel();
+    pixels = (uint8_t*)calloc(numBytes, 1);
+    numLEDs = pixels != NULL ? n : 0;
+    if (pixels == NULL) {
+        numBytes = 0;
+    }
+}
+
+void Adafruit_NeoPixel::updateType(neoPixelType t) {
+    bool oldThreeBytesPerPixel = (wOffset == rOffset);
+
+    wOffset = (t >> 6) & 0x03;
+    rOffset = (t >> 4) & 0x03;
+    gOffset = (t >> 2) & 0x03;
+    bOffset = t & 0x03;
+
+    if (pixels != NULL && oldThreeBytesPerPixel != (wOffset == rOffset)) {
+        updateLength(numLEDs);
+    }
+}
+
+void Adafruit_NeoPixel::show() {
+    simOnShow(*this);
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b) {
+    if (n >= numLEDs) {
+        return;
+    }
+    if (brightness) {
+        r = (r * brightness) >> 8;
+        g = (g * brightness) >> 8;
+        b = (b * brightness) >> 8;
+    }
+    uint8_t* p = &pixels[n * bytesPerPixel()];
+    if (wOffset != rOffset) {
+        p[wOffset] = 0;
+    }
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b, uint8_t w) {
+    if (n >= numLEDs) {
+        return;
+    }
+    if (brightness) {
+        r = (r * brightness) >> 8;
+        g = (g * brightness) >> 8;
+        b = (b * brightness) >> 8;
+        w = (w * brightness) >> 8;
+    }
+    uint8_t* p = &pixels[n * bytesPerPixel()];
+    if (wOffset != rOffset) {
+        p[wOffset] = w;
+    }
+    p[rOffset] = r;
+    p[gOffset] = g;
+    p[bOffset] = b;
+}
+
+void Adafruit_NeoPixel::setPixelColor(uint16_t n, uint32_t c) {
+    setPixelColor(n, (uint8_t)(c >> 16), (uint8_t)(c >> 8), (uint8_t)c, (uint8_t)(c >> 24));
+}
+
+void Adafruit_NeoPixel::fill(uint32_t c, uint16_t first, uint16_t count) {
+    if (first >= numLEDs) {
+        return;
+    }
+    uint16_t end = (count == 0 || first + count > numLEDs) ? numLEDs : first + count;
+    for (uint16_t i = first; i < end; i++) {
+        setPixelColor(i, c);
+    }
+}
+
+void Adafruit_NeoPixel::setBrightness(uint8_t b) {
+    // Même rééchelonnement (avec pertes) du tampon que la bibliothèque
+    uint8_t newBrightness = b + 1;
+    if (newBrightness == brightness) {
+        return;
+    }
+    uint8_t oldBrightness = brightness - 1;
+    uint16_t scale;
+    if (oldBrightness == 0) {
+        scale = 0;
+    } else if (b == 255) {
+        scale = 65535 / oldBrightness;
+    } else {
+        scale = (((uint16_t)newBrightness << 8) - 1) / oldBrightness;
+    }
+    for (uint16_t i = 0; i < numBytes; i++) {
+        pixels[i] = (pixels[i] * scale) >> 8;
+    }
+    brightness = newBrightness;
+}
+
+void Adafruit_NeoPixel::clear() {
+    memset(pixels, 0, numBytes);
+}
+
+uint32_t Adafruit_NeoPixel::getPixelColor(uint16_t n) const {
+    if (n >= numLEDs) {
+        return 0;
+    }
+    const uint8_t* p = &pixels[n * bytesPerPixel()];
+    uint32_t w = wOffset != rOffset ? p[wOffset] : 0;
+    uint32_t c = (w << 24) | ((uint32_t)p[rOffset] << 16) | ((uint32_t)p[gOffset] << 8) | p[bOffset];
+    if (brightness) {
+        // Approximation de la valeur d'origine, comme la bibliothèque
+        uint8_t r = ((uint16_t)p[rOffset] << 8) / brightness;
+        uint8_t g = ((uint16_t)p[gOffset] << 8) / brightness;
+        uint8_t b = ((uint16_t)p[bOffset] << 8) / brightness;
+        uint8_t wb = (uint8_t)((w << 8) / brightness);
+        c = ((uint32_t)wb << 24) | ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+    }
+    return c;
+}
+
+uint8_t Adafruit_NeoPixel::sine8(uint8_t x) {
+    return (uint8_t)(sin(x * TWO_PI / 256.0) * 127.5 + 128.0);
+}
+
+uint8_t Adafruit_NeoPixel::gamma8(uint8_t x) {
+    return (uint8_t)(pow(x / 255.0, 2.6) * 255.0 + 0.5);
+}
+
+uint32_t Adafruit_NeoPixel::gamma32(uint32_t x) {
+    uint8_t* y = (uint8_t*)&x;
+    for (uint8_t i = 0; i < 4; i++) {
+        y[i] = gamma8(y[i]);
+    }
+    return x;
+}
+
+uint32_t Adafruit_NeoPixel::ColorHSV(uint16_t hue, uint8_t sat, uint8_t val) {
+    uint8_t r, g, b;
+
+    // Même découpage en six secteurs et mêmes arrondis que la bibliothèque
+    hue = (hue * 1530L + 32768) / 65536;
+    if (hue < 510) {
+        b = 0;
+        if (hue < 255) {
+            r = 255;
+            g = hue;
+        } else {
+            r = 510 - hue;
+            g = 255;
+        }
+    } else if (hue < 1020) {
+        r = 0;
+        if (hue < 765) {
+            g = 255;
+            b = hue - 510;
+        } else {
+            g = 1020 - hue;
+            b = 255;
+        }
+    } else if (hue < 1530) {
+        g = 0;
+        if (hue < 1275) {
+            r = hue - 1020;
+            b = 255;
+        } else {
+            r = 255;
+            b = 1530 - hue;
+        }
+    } else {
+        r = 255;
+        g = b = 0;
+    }
+
+    uint32_t v1 = 1 + val;
+    uint16_t s1 = 1 + sat;
+    uint8_t s2 = 255 - sat;
+    return ((((((r * s1) >> 8) + s2) * v1) & 0xff00) << 8) |
+           (((((g * s1) >> 8) + s2) * v1) & 0xff00) |
+           (((((b * s1) >> 8) + s2) * v1) >> 8);
+}
@@ -0,0 +1,328 @@
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "SimHost.h"
+
+HardwareSerial Serial;
+
+static uint64_t clockMicros = 0;
+static bool showTimeModel = true;
+static bool serialEcho = true;
+static FILE* frameDump = NULL;
+static unsigned long showCount = 0;
+static uint64_t nextPinEventMicros = UINT64_MAX;
+static bool slept = false;
+
+static const uint8_t PIN_COUNT = 32;
+static int pinLevels[PIN_COUNT];
+static bool pinLevelsReady = false;
+
+static const uint8_t INTERRUPT_COUNT = 2;
+static void (*interruptHandlers[INTERRUPT_COUNT])(void) = { NULL, NULL };
+static int interruptModes[INTERRUPT_COUNT] = { 0, 0 };
+static bool interruptsEnabled = true;
+
+static unsigned long randomState = 1;
+
+static void initPins() {
+    if (!pinLevelsReady) {
+        for (uint8_t i = 0; i < PIN_COUNT; i++) {
+            pinLevels[i] = HIGH;
+        }
+        pinLevelsReady = true;
+    }
+}
+
+// Horloge virtuelle
+
+uint64_t simTimeMicros() {
+    return clockMicros;
+}
+
+void simSetTimeMicros(uint64_t us) {
+    clockMicros = us;
+}
+
+void simAdvanceMicros(uint64_t us) {
+    clockMicros += us;
+}
+
+unsigned long millis() {
+    return (unsigned long)(clockMicros / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)clockMicros;
+}
+
+bool simSleepUntil(uint64_t wakeMicros) {
+    slept = true;
+    if (nextPinEventMicros < wakeMicros) {
+        if (nextPinEventMicros > clockMicros) {
+            clockMicros = nextPinEventMicros;
+        }
+        return true;
+    }
+    if (wakeMicros > clockMicros) {
+        clockMicros = wakeMicros;
+    }
+    return false;
+}
+
+bool simTakeSleep() {
+    bool result = slept;
+    slept = false;
+    return result;
+}
+
+void simSetNextPinEvent(uint64_t timeMicros) {
+    nextPinEventMicros = timeMicros;
+}
+
+void delay(unsigned long ms) {
+    clockMicros += (uint64_t)ms * 1000;
+}
+
+void delayMicroseconds(unsigned int us) {
+    clockMicros += us;
+}
+
+// Broches et interruptions
+
+void pinMode(uint8_t pin, uint8_t mode) {
+    initPins();
+    (void)pin;
+    (void)mode;
+}
+
+int digitalRead(uint8_t pin) {
+    initPins();
+    return pin < PIN_COUNT ? pinLevels[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+    initPins();
+    if (pin < PIN_COUNT) {
+        pinLevels[pin] = value ? HIGH : LOW;
+    }
+}
+
+void simSetPin(uint8_t pin, int level) {
+    initPins();
+    if (pin >= PIN_COUNT) {
+        return;
+    }
+
+    int previous = pinLevels[pin];
+    pinLevels[pin] = level ? HIGH : LOW;
+
+    int interruptNumber = digitalPinToInterrupt(pin);
+    if (interruptNumber < 0 || !interruptsEnabled || previous == pinLevels[pin]) {
+        return;
+    }
+
+    void (*handler)(void) = interruptHandlers[interruptNumber];
+    int mode = interruptModes[interruptNumber];
+    bool rising = pinLevels[pin] == HIGH;
+    if (handler != NULL && (mode == CHANGE || (mode == RISING && rising) || (mode == FALLING && !rising))) {
+        handler();
+    }
+}
+
+void attachInterrupt(uint8_t interruptNumber, void (*isr)(void), int mode) {
+    if (interruptNumber < INTERRUPT_COUNT) {
+        interruptHandlers[interruptNumber] = isr;
+        interruptModes[interruptNumber] = mode;
+    }
+}
+
+void detachInterrupt(uint8_t interruptNumber) {
+    if (interruptNumber < INTERRUPT_COUNT) {
+        interruptHandlers[interruptNumber] = NULL;
+    }
+}
+
+void noInterrupts() {
+    interruptsEnabled = false;
+}
+
+void interrupts() {
+    interruptsEnabled = true;
+}
+
+// Nombres pseudo-aléatoires : générateur « minimal standard » de avr-libc
+
+static long nextRandom() {
+    long x = (long)randomState;
+    if (x == 0) {
+        x = 123459876L;
+    }
+    long hi = x / 127773L;
+    long lo = x % 127773L;
+    x = 16807L * lo - 2836L * hi;
+    if (x < 0) {
+        x += 0x7fffffffL;
+    }
+    randomState = (unsigned long)x;
+    return x % 0x80000000L;
+}
+
+long random(long howbig) {
+    if (howbig == 0) {
+        return 0;
+    }
+    return nextRandom() % howbig;
+}
+
+long random(long howsmall, long howbig) {
+    if (howsmall >= howbig) {
+        return howsmall;
+    }
+    return random(howbig - howsmall) + howsmall;
+}
+
+void randomSeed(unsigned long seed) {
+    if (seed != 0) {
+        randomState = seed;
+    }
+}
+
+// Trames
+
+void simSetShowTimeModel(bool enabled) {
+    showTimeModel = enabled;
+}
+
+void simSetFrameDump(FILE* file) {
+    frameDump = file;
+}
+
+unsigned long simShowCount() {
+    return showCount;
+}
+
+void simOnShow(const Adafruit_NeoPixel& strip) {
+    showCount++;
+
+    if (frameDump != NULL) {
+        const uint8_t* pixels = strip.getPixels();
+        uint8_t stride = strip.bytesPerPixel();
+        fprintf(frameDump, "%lu", millis());
+        for (uint16_t i = 0; i < strip.numPixels(); i++) {
+            const uint8_t* p = pixels + i * stride;
+            fprintf(frameDump, " %02X%02X%02X", p[strip.redOffset()], p[strip.greenOffset()], p[strip.blueOffset()]);
+        }
+        fputc('\n', frameDump);
+    }
+
+    // Transfert WS2812 à 800 kHz : 10 µs par octet (30 µs par pixel RGB), puis 50 µs de verrouillage
+    if (showTimeModel) {
+        clockMicros += (uint64_t)strip.numPixels() * strip.bytesPerPixel() * 10 + 50;
+    }
+}
+
+// Port série
+
+void simSetSerialEcho(bool enabled) {
+    serialEcho = enabled;
+}
+
+void HardwareSerial::begin(unsigned long baud) {
+    (void)baud;
+}
+
+size_t HardwareSerial::write(uint8_t c) {
+    if (serialEcho) {
+        fputc(c, stdout);
+    }
+    return 1;
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size) {
+    if (serialEcho) {
+        fwrite(buffer, 1, size, stdout);
+    }
+    return size;
+}
+
+static size_t printNumber(unsigned long value, int base, bool negative) {
+    char buffer[8 * sizeof(unsigned long) + 2];
+    char* p = &buffer[sizeof(buffer) - 1];
+    *p = '\0';
+    if (base < 2) {
+        base = 10;
+    }
+    do {
+        unsigned long digit = value % base;
+        value /= base;
+        *--p = digit < 10 ? '0' + digit : 'A' + digit - 10;
+    } while (value != 0);
+    if (negative) {
+        *--p = '-';
+    }
+    return Serial.print(p);
+}
+
+size_t HardwareSerial::print(const char* text) {
+    return write((const uint8_t*)text, strlen(text));
+}
+
+size_t HardwareSerial::print(char c) {
+    return write((uint8_t)c);
+}
+
+size_t HardwareSerial::print(int value, int base) {
+    return print((long)value, base);
+}
+
+size_t HardwareSerial::print(unsigned int value, int base) {
+    return print((unsigned long)value, base);
+}
+
+size_t HardwareSerial::print(long value, int base) {
+    if (base == 10 && value < 0) {
+        return printNumber((unsigned long)-value, base, true);
+    }
+    return printNumber((unsigned long)value, base, false);
+}
+
+size_t HardwareSerial::print(unsigned long value, int base) {
+    return printNumber(value, base, false);
+}
+
+size_t HardwareSerial::print(double value, int digits) {
+    char buffer[48];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return print(buffer);
+}
+
+size_t HardwareSerial::println() {
+    return print("\r\n");
+}
+
+size_t HardwareSerial::println(const char* text) {
+    return print(text) + println();
+}
+
+size_t HardwareSerial::println(char c) {
+    return print(c) + println();
+}
+
+size_t HardwareSerial::println(int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(unsigned int value, int base) {
+    return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(unsigned long value, int base) {
+    return print(value, base) + println();
+}
+
+size_t HardwareSerial::println(double value, int digits) {
+    return print(value, digits) + println();
+}
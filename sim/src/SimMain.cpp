@@ -0,0 +1,157 @@
+// Point d'entrée de la simulation hôte : exécute setup() puis loop() sur une horloge virtuelle.
+// Exclu des tests (pio test -e native) : chaque test fournit son propre main().
+
+#ifndef PIO_UNIT_TESTING
+
+#include <Arduino.h>
+#include <stdio.h>
+#include <time.h>
+#include <vector>
+#include <algorithm>
+#include "SimHost.h"
+
+struct PinEvent {
+    uint64_t timeMicros;
+    uint8_t pin;
+    int level;
+
+    bool operator<(const PinEvent& other) const { return timeMicros < other.timeMicros; }
+};
+
+static void printUsage(const char* program) {
+    fprintf(stderr,
+            "Usage : %s [options]\n"
+            "  --duration <s>     durée simulée en secondes (défaut : 10)\n"
+            "  --step <us>        avance de l'horloge à chaque loop() sans mise en veille (défaut : 100)\n"
+            "  --buttons <file>   script d'appuis, lignes \"<ms> press|release [broche]\"\n"
+            "  --dump <file>      export des trames, une ligne \"millis RRGGBB ...\" par show()\n"
+            "  --seed <n>         randomSeed(n) avant setup()\n"
+            "  --quiet            pas d'écho du port série\n"
+            "  --no-show-time     show() ne consomme pas de temps virtuel\n",
+            program);
+}
+
+// Script de boutons : "<ms> press|release [broche]", commentaires après '#'.
+// Le bouton est câblé en pull-up : appuyé = LOW.
+static bool loadButtonScript(const char* path, std::vector<PinEvent>& events) {
+    FILE* file = fopen(path, "r");
+    if (file == NULL) {
+        fprintf(stderr, "Impossible d'ouvrir %s\n", path);
+        return false;
+    }
+
+    char line[128];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lineNumber++;
+        char* comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+
+        unsigned long timeMs;
+        char action[16];
+        int pin = 2;
+        int fields = sscanf(line, "%lu %15s %d", &timeMs, action, &pin);
+        if (fields <= 0) {
+            continue;
+        }
+        if (fields < 2 || (strcmp(action, "press") != 0 && strcmp(action, "release") != 0)) {
+            fprintf(stderr, "%s:%d : ligne invalide\n", path, lineNumber);
+            fclose(file);
+            return false;
+        }
+
+        PinEvent event;
+        event.timeMicros = (uint64_t)timeMs * 1000;
+        event.pin = (uint8_t)pin;
+        event.level = strcmp(action, "press") == 0 ? LOW : HIGH;
+        events.push_back(event);
+    }
+
+    fclose(file);
+    std::stable_sort(events.begin(), events.end());
+    return true;
+}
+
+int main(int argc, char** argv) {
+    double durationSeconds = 10.0;
+    unsigned long stepMicros = 100;
+    const char* buttonScript = NULL;
+    const char* dumpPath = NULL;
+    unsigned long seed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+        if (strcmp(argv[i], "--duration") == 0 && hasValue) {
+            durationSeconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--step") == 0 && hasValue) {
+            stepMicros = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--buttons") == 0 && hasValue) {
+            buttonScript = argv[++i];
+        } else if (strcmp(argv[i], "--dump") == 0 && hasValue) {
+            dumpPath = argv[++i];
+        } else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            seed = strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--quiet") == 0) {
+            simSetSerialEcho(false);
+        } else if (strcmp(argv[i], "--no-show-time") == 0) {
+            simSetShowTimeModel(false);
+        } else {
+            printUsage(argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<PinEvent> events;
+    if (buttonScript != NULL && !loadButtonScript(buttonScript, events)) {
+        return 1;
+    }
+
+    FILE* dump = NULL;
+    if (dumpPath != NULL) {
+        dump = fopen(dumpPath, "w");
+        if (dump == NULL) {
+            fprintf(stderr, "Impossible d'écrire %s\n", dumpPath);
+            return 1;
+        }
+        simSetFrameDump(dump);
+    }
+
+    if (seed != 0) {
+        randomSeed(seed);
+    }
+
+    clock_t wallStart = clock();
+    uint64_t endMicros = (uint64_t)(durationSeconds * 1e6);
+    unsigned long loops = 0;
+    size_t nextEvent = 0;
+
+    setup();
+
+    while (simTimeMicros() < endMicros) {
+        // Appliquer les changements de niveau arrivés à échéance
+        while (nextEvent < events.size() && events[nextEvent].timeMicros <= simTimeMicros()) {
+            simSetPin(events[nextEvent].pin, events[nextEvent].level);
+            nextEvent++;
+        }
+        simSetNextPinEvent(nextEvent < events.size() ? events[nextEvent].timeMicros : UINT64_MAX);
+
+        loop();
+        loops++;
+        if (!simTakeSleep()) {
+            simAdvanceMicros(stepMicros);
+        }
+    }
+
+    double wallSeconds = (double)(clock() - wallStart) / CLOCKS_PER_SEC;
+    fprintf(stderr, "Simulé %.3f s en %.3f s : %lu loop(), %lu show()\n",
+            simTimeMicros() / 1e6, wallSeconds, loops, simShowCount());
+
+    if (dump != NULL) {
+        fclose(dump);
+    }
+    return 0;
+}
+
+#endif // PIO_UNIT_TESTING
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "BlendKernel.h"
+#include "LedConfig.h"
+#include <string.h>
+
+// Masques des voies de 8 bits d'un mot de 32 bits
+static const uint32_t LANES_EVEN = 0x00FF00FFUL;   // Octets 0 et 2, une voie de 16 bits chacun
+static const uint32_t HIGH_BITS = 0x80808080UL;
+static const uint32_t LOW_BITS = 0x7F7F7F7FUL;
+
+// Multiplie les quatre octets de x par weight / 256 (weight <= 256), deux voies par multiplication
+static inline uint32_t scaleBytes(uint32_t x, uint16_t weight) {
+    uint32_t even = ((x & LANES_EVEN) * weight >> 8) & LANES_EVEN;
+    uint32_t odd = (((x >> 8) & LANES_EVEN) * weight) & ~LANES_EVEN;
+    return even | odd;
+}
+
+// Somme saturée octet par octet
+static inline uint32_t addBytes(uint32_t a, uint32_t b) {
+    uint32_t sum = (a & LOW_BITS) + (b & LOW_BITS);         // Sans retenue entre octets
+    uint32_t carry = ((a & b) | ((a | b) & sum)) & HIGH_BITS; // Retenue sortant de chaque octet
+    sum ^= (a ^ b) & HIGH_BITS;
+    return sum | ((carry >> 7) * 0xFF);
+}
+
+// Maximum octet par octet : soustraction sur des voies de 16 bits munies d'un bit de garde
+static inline uint32_t maxLanes(uint32_t a, uint32_t b) {
+    uint32_t diff = ((a | 0x01000100UL) - b) & 0x01000100UL;  // Bit de garde conservé si a >= b
+    uint32_t mask = (diff >> 8) * 0xFF;
+    return (a & mask) | (b & ~mask & LANES_EVEN);
+}
+
+static inline uint32_t maxBytes(uint32_t a, uint32_t b) {
+    uint32_t even = maxLanes(a & LANES_EVEN, b & LANES_EVEN);
+    uint32_t odd = maxLanes((a >> 8) & LANES_EVEN, (b >> 8) & LANES_EVEN);
+    return even | (odd << 8);
+}
+
+// dst * (256 - weight) + src * weight, sur 256, deux voies par multiplication (somme <= 65280)
+static inline uint32_t mixBytes(uint32_t dst, uint32_t src, uint16_t weight) {
+    uint16_t inverse = 256 - weight;
+    uint32_t even = (((dst & LANES_EVEN) * inverse + (src & LANES_EVEN) * weight) >> 8) & LANES_EVEN;
+    uint32_t odd = (((dst >> 8) & LANES_EVEN) * inverse + ((src >> 8) & LANES_EVEN) * weight) & ~LANES_EVEN;
+    return even | odd;
+}
+
+void blendSpan(uint8_t* dst, const uint8_t* src, uint16_t count, BlendOp op, uint8_t opacity) {
+    if (opacity == 0) {
+        return;
+    }
+
+    uint16_t i = 0;
+    if (op != BLEND_SCREEN) {
+        uint16_t weight = opacity + 1;
+        uint16_t alpha = opacity + (opacity >> 7);
+
+        // Mots de 4 octets (copie via memcpy : pas d'hypothèse d'alignement)
+        for (; i + 4 <= count; i += 4) {
+            uint32_t d, s;
+            memcpy(&d, dst + i, 4);
+            memcpy(&s, src + i, 4);
+
+            if (op == BLEND_ALPHA) {
+                d = mixBytes(d, s, alpha);
+            } else {
+                if (weight != 256) {
+                    s = scaleBytes(s, weight);
+                }
+                d = op == BLEND_ADD ? addBytes(d, s) : maxBytes(d, s);
+            }
+            memcpy(dst + i, &d, 4);
+        }
+    }
+
+    // Reste (ou screen) octet par octet
+    for (; i < count; i++) {
+        dst[i] = blendChannel(dst[i], src[i], op, opacity);
+    }
+}
+
+void blendPixel(uint8_t* pixel, uint8_t r, uint8_t g, uint8_t b, BlendOp op, uint8_t opacity) {
+    pixel[LED_OFFSET_R] = blendChannel(pixel[LED_OFFSET_R], r, op, opacity);
+    pixel[LED_OFFSET_G] = blendChannel(pixel[LED_OFFSET_G], g, op, opacity);
+    pixel[LED_OFFSET_B] = blendChannel(pixel[LED_OFFSET_B], b, op, opacity);
+}
\ No newline at end of file
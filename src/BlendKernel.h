@@ -0,0 +1,49 @@
+#ifndef BLEND_KERNEL_H
+#define BLEND_KERNEL_H
+
+#include <Arduino.h>
+
+// Opérations de fusion d'une couche sur la trame (canal par canal, 8 bits)
+enum BlendOp : uint8_t {
+    BLEND_ADD,      // Somme saturée
+    BLEND_MAX,      // Maximum
+    BLEND_ALPHA,    // Mélange linéaire selon l'opacité
+    BLEND_SCREEN    // 1 - (1 - a)(1 - b) : éclaircit sans saturer brutalement
+};
+
+// Fusionne count octets de src dans dst (tampons au format de la bande, même orientation).
+// opacity (0-255) pondère la couche : 255 applique l'opération pleinement, 0 laisse dst intact.
+// Les canaux sont indépendants : add, max et alpha traitent 4 octets par mot de 32 bits
+// (deux canaux par multiplication), screen reste octet par octet (produit de deux variables).
+void blendSpan(uint8_t* dst, const uint8_t* src, uint16_t count, BlendOp op, uint8_t opacity);
+
+// Fusionne un seul canal (utilisé pour les couches creuses, pixel par pixel)
+inline uint8_t blendChannel(uint8_t dst, uint8_t src, BlendOp op, uint8_t opacity) {
+    // Opacité appliquée à la couche : src * (opacity + 1) / 256 (sauf pour alpha)
+    uint16_t weight = opacity + 1;
+    uint16_t result;
+
+    switch (op) {
+        case BLEND_ADD:
+            result = dst + ((src * weight) >> 8);
+            return result > 255 ? 255 : result;
+        case BLEND_MAX:
+            src = (src * weight) >> 8;
+            return src > dst ? src : dst;
+        case BLEND_ALPHA:
+            weight = opacity + (opacity >> 7);   // 0-256
+            return (dst * (256 - weight) + src * weight) >> 8;
+        default: {
+            // Screen puis mélange avec dst selon l'opacité. Le produit atteint 65280 : opérandes
+            // en uint16_t pour qu'il soit non signé (un int de 16 bits déborderait sur AVR).
+            uint8_t screen = 255 - (((uint16_t)(255 - dst) * (uint16_t)(256 - src)) >> 8);
+            weight = opacity + (opacity >> 7);
+            return (dst * (256 - weight) + screen * weight) >> 8;
+        }
+    }
+}
+
+// Fusionne une couleur RGB dans un pixel du tampon de la bande
+void blendPixel(uint8_t* pixel, uint8_t r, uint8_t g, uint8_t b, BlendOp op, uint8_t opacity);
+
+#endif // BLEND_KERNEL_H
\ No newline at end of file
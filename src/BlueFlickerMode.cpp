@@ -1,171 +1,105 @@
 #include "BlueFlickerMode.h"
 #include "Utils.h"
-#include <math.h>
+#include "LookupTables.h"
+#include "ColorKernel.h"
 #include <Arduino.h>
 
-BlueFlickerMode::BlueFlickerMode(Adafruit_NeoPixel* strip, float* globalParam) 
-    : LightingMode(strip, globalParam) {
-    // Initialisation des variables spécifiques au mode scintillement bleu
-    minLedSpeed = 0.0002;
-    maxLedSpeed = 0.001;
-    minLedForce = 0.0;
-    maxLedForce = 1.0;
-    hueMin = 34768;   // 180 degrés (cyan)
-    hueMax = 51152;   // 270 degrés (violet)
-    intensityMin = 0.0025;
-    intensityMax = 1.0;
-    intensityExponent = 3.0; // Exposant pour la conversion non linéaire
-
-    // Variables pour le mode étoile
-    maxStars = 2;             // Nombre maximum de LEDs en mode étoile simultanément
-    starProbability = 0.00005; // Probabilité pour une LED d'entrer en mode étoile à chaque mise à jour
-    starMinIntensityStart = 0.0;
-    starMaxIntensityStart = 0.1;
-    starMinIntensityEnd = 0.2;
-    starMaxIntensityEnd = 1.0;
-    starMinRiseTime = 50;    // Temps de montée minimum en ms
-    starMaxRiseTime = 500;    // Temps de montée maximum en ms
-    starMinFallTime = 100;    // Temps de descente minimum en ms
-    starMaxFallTime = 1000;    // Temps de descente maximum en ms
-
-    unsigned long initialTime = millis();
-    for (int i = 0; i < NUM_LEDS_FLICKER; i++) {
-        ledForce[i] = randomFloat(minLedForce, maxLedForce);
-        ledSpeed[i] = randomFloat(minLedSpeed, maxLedSpeed);
-        lastUpdateFlicker[i] = initialTime;
-
-        // Initialisation des bornes de force individuelles
-        ledMinForce[i] = randomFloat(0.0, 0.3);
-        ledMaxForce[i] = randomFloat(0.7, 1.0);
-
-        // Initialisation du mode étoile
-        isStarMode[i] = false;
-        starCurrentIntensity[i] = 0.0;
-        starStartTime[i] = 0;
-        starDuration[i] = 0;
-        starRiseTimeActual[i] = 0;
-        starFallTimeActual[i] = 0;
-        starMaxIntensityEndActual[i] = 0.0;
+template <typename Tuning>
+TunedBlueFlickerMode<Tuning>::TunedBlueFlickerMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment) 
+    : LightingMode(strip, parameterBank, ledSegment, 0xB1F11C3EUL), stars(starPool), globalWatch(PARAM_GLOBAL) {
+    // Initialisation des variables spécifiques au mode scintillement bleu (réglages : voir BlueFlickerClassic)
+    for (uint16_t i = 0; i < segment.length; i++) {
+        FlickerLed& led = ledStates[i];
+        led.force = rng.unit();
+        led.speed = rng.range(minLedSpeed, maxLedSpeed);
+
+        // Initialisation des bornes de force individuelles (0.0-0.3 et 0.7-1.0)
+        led.minForce = rng.range(0, 77);
+        led.maxForce = rng.range(178, 256);
     }
-}
 
-void BlueFlickerMode::update() {
-    unsigned long currentMillis = millis();
+    reset();
+}
 
-    int currentStars = 0;
-    // Compter le nombre de LEDs en mode étoile
-    for (int i = 0; i < NUM_LEDS_FLICKER; i++) {
-        if (isStarMode[i]) {
-            currentStars++;
-        }
+template <typename Tuning>
+void TunedBlueFlickerMode<Tuning>::renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) {
+    // Variables dépendantes du paramètre global, recalculées seulement s'il a changé
+    if (globalWatch.changed(*parameters)) {
+        applyParameters();
     }
 
-    // Calcul des variables dynamiques basées sur globalParameter
-    float dynamicIntensityMax = mapf(*globalParameter, 0.0, 100.0, 0.2, 1.0);
-    float dynamicIntensityExponent = mapf(*globalParameter, 0.0, 100.0, 2.0, 3.0);
-    float dynamicStarProbability = mapf(*globalParameter, 0.0, 100.0, 0.00005, 0.000025);
-    float dynamicStarMaxIntensityEnd = mapf(*globalParameter, 0.0, 100.0, 0.5, 1.0);
-
-    // Mise à jour des variables dépendantes de globalParameter
-    intensityMax = dynamicIntensityMax;
-    intensityExponent = dynamicIntensityExponent;
-    starProbability = dynamicStarProbability;
-    // starMaxIntensityEndActual est géré par LED individuelle
-
-    for (int i = 0; i < NUM_LEDS_FLICKER; i++) {
-        // Gestion du mode étoile
-        if (isStarMode[i]) {
-            updateStarMode(i, currentMillis);
-            continue; // Passer à la LED suivante
-        } else if (currentStars < maxStars && randomFloat(0.0, 1.0) < starProbability) {
-            // La LED entre en mode étoile
-            isStarMode[i] = true;
-            starStartTime[i] = currentMillis;
-            starRiseTimeActual[i] = random(starMinRiseTime, starMaxRiseTime);
-            starFallTimeActual[i] = random(starMinFallTime, starMaxFallTime);
-            starDuration[i] = starRiseTimeActual[i] + starFallTimeActual[i];
-            starCurrentIntensity[i] = starMinIntensityStart;
-
-            // Intensités de début et de fin pour l'animation
-            starMinIntensityStart = randomFloat(0.0, 0.1);
-            starMaxIntensityEndActual[i] = randomFloat(0.5, 1.0) * (dynamicStarMaxIntensityEnd / 1.0); // Ajusté selon globalParameter
-
-            currentStars++;
-            continue; // Passer à la LED suivante
-        }
+    // Temps écoulé depuis la trame précédente, le même pour toutes les LEDs (borné sur 16 bits)
+    uint16_t frameTime = dt > 0xFFFF ? 0xFFFF : dt;
 
-        // Calculer le temps écoulé depuis la dernière mise à jour de cette LED
-        unsigned long deltaTime = currentMillis - lastUpdateFlicker[i];
-        lastUpdateFlicker[i] = currentMillis;
+    // Marche aléatoire : n pas de ±vitesse × période d'origine donnent un écart de l'ordre de
+    // √n × pas. Un seul pas par trame de durée dt garde la même dispersion au cours du temps avec
+    // un pas de vitesse × √(dt × période), et non vitesse × dt (trop ample quand dt grandit).
+    uint16_t walkTime = sqrtU32((uint32_t)frameTime * Tuning::updatePeriod);
+    uint32_t speedChangeChance = FastRandom::scaledThreshold(speedChangeThreshold, frameTime);
 
-        // Mettre à jour la force de la LED en fonction de la vitesse et de la direction aléatoire
-        ledForce[i] += ledSpeed[i] * deltaTime * ((random(0, 2) == 0) ? -1 : 1);
+    uint8_t* pixel = span.data;
+    for (uint16_t i = 0; i < span.length; i++, pixel += span.stride) {
+        FlickerLed& led = ledStates[i];
 
-        // Limiter la force entre les bornes individuelles
-        if (ledForce[i] > ledMaxForce[i]) {
-            ledForce[i] = ledMaxForce[i];
-        } else if (ledForce[i] < ledMinForce[i]) {
-            ledForce[i] = ledMinForce[i];
+        // Mettre à jour la force de la LED en fonction de la vitesse et de la direction aléatoire
+        int32_t step = ((uint32_t)led.speed * walkTime) >> 8;
+        int32_t force = (int32_t)led.force + (rng.coin() ? -step : step);
+
+        // Limiter la force entre les bornes individuelles (0-255 étendu à 0-65535)
+        int32_t forceMax = led.maxForce * 257;
+        int32_t forceMin = led.minForce * 257;
+        if (force > forceMax) {
+            force = forceMax;
+        } else if (force < forceMin) {
+            force = forceMin;
         }
+        led.force = force;
 
         // Changer de vitesse de manière aléatoire
-        if (random(0, 1000) < 10) { // Probabilité de changer de vitesse
-            ledSpeed[i] = randomFloat(minLedSpeed, maxLedSpeed);
+        if (rng.chance(speedChangeChance)) { // Probabilité de changer de vitesse pendant la trame
+            led.speed = rng.range(minLedSpeed, maxLedSpeed);
         }
 
         // Calculer la teinte en fonction de la force
-        uint16_t hue = hueMin + (uint16_t)((float)(hueMax - hueMin) * ledForce[i]);
+        uint16_t hue = Tuning::hueMin + (uint16_t)(((uint32_t)(Tuning::hueMax - Tuning::hueMin) * led.force) >> 16);
 
-        // Conversion non linéaire de l'intensité avec exponent
-        float normalizedForce = (ledForce[i] - minLedForce) / (maxLedForce - minLedForce);
-        float intensity = intensityMin + (intensityMax - intensityMin) * pow(normalizedForce, intensityExponent) * (*globalParameter / 100.0);
+        // Conversion non linéaire de l'intensité avec exponent (force déjà normalisée sur 0-1)
+        unit16_t intensity = unitAdd(intensityMinUnit, unitMul(lutPowUnit(led.force, exponent), intensityScale));
 
-        // Limiter l'intensité entre 0 et 1
-        intensity = constrain(intensity, 0.0, 1.0);
+        uint8_t value = unitTo8(intensity);
 
-        uint8_t value = (uint8_t)(intensity * 255);
-
-        // Obtenir la couleur HSV
-        uint32_t color = leds->ColorHSV(hue, 255, value);
-
-        // Appliquer la couleur à la LED
-        leds->setPixelColor(i, color);
+        // Écrire la couleur HSV directement dans le tampon de la bande
+        hsvToPixel(pixel, hue, 255, value);
     }
 
-    leds->show();
+    // Étoiles : le maximum par canal garde le blanc au-dessus du bleu, sans figer le scintillement dessous
+    stars.composite(span, BLEND_MAX, 255, now, dt);
 }
 
-void BlueFlickerMode::updateStarMode(int index, unsigned long currentMillis) {
-    unsigned long elapsedTime = currentMillis - starStartTime[index];
-
-    if (elapsedTime < starRiseTimeActual[index]) {
-        // Phase de montée
-        float t = (float)elapsedTime / (float)starRiseTimeActual[index];
-        starCurrentIntensity[index] = starMinIntensityStart + t * (starMaxIntensityEndActual[index] - starMinIntensityStart);
-    } else if (elapsedTime < starDuration[index]) {
-        // Phase de descente
-        float t = (float)(elapsedTime - starRiseTimeActual[index]) / (float)starFallTimeActual[index];
-        starCurrentIntensity[index] = starMaxIntensityEndActual[index] * (1.0 - t);
-    } else {
-        // Fin du mode étoile
-        isStarMode[index] = false;
-        starCurrentIntensity[index] = 0.0;
-        return;
-    }
-
-    // Limiter l'intensité entre 0 et 1
-    float intensity = constrain(starCurrentIntensity[index], 0.0, 1.0);
+template <typename Tuning>
+void TunedBlueFlickerMode<Tuning>::applyParameters() {
+    float globalParameter = parameters->get(PARAM_GLOBAL);
 
-    uint8_t value = (uint8_t)(intensity * 255);
+    // Calcul des variables dynamiques basées sur globalParameter
+    float intensityMax = mapf(globalParameter, 0.0, 100.0, Tuning::intensityMaxLow, Tuning::intensityMaxHigh);
+    float intensityExponent = mapf(globalParameter, 0.0, 100.0, Tuning::intensityExponentLow, Tuning::intensityExponentHigh);
+    float starProbability = mapf(globalParameter, 0.0, 100.0, Tuning::starProbabilityLow, Tuning::starProbabilityHigh);
+    float starMaxIntensityEnd = mapf(globalParameter, 0.0, 100.0, Tuning::starPeakLow, Tuning::starPeakHigh);
+
+    // Mise à jour des étoiles
+    stars.setProbability(starProbability, Tuning::updatePeriod);
+    stars.setPeakMax((uint8_t)(starMaxIntensityEnd * 255));
+
+    // Termes de la conversion d'intensité
+    exponent = q88FromFloat(intensityExponent);
+    intensityScale = unitFromFloat((intensityMax - Tuning::intensityMin) * (globalParameter / 100.0));
+}
 
-    // Couleur blanche
-    leds->setPixelColor(index, value, value, value);
+template <typename Tuning>
+void TunedBlueFlickerMode<Tuning>::reset() {
+    // Libérer tous les emplacements d'étoile
+    stars.reset();
 }
 
-void BlueFlickerMode::reset() {
-    // Réinitialiser les variables si nécessaire
-    for (int i = 0; i < NUM_LEDS_FLICKER; i++) {
-        isStarMode[i] = false;
-        starCurrentIntensity[i] = 0.0;
-    }
-}
\ No newline at end of file
+// Seul le préréglage retenu à la compilation est instancié
+template class TunedBlueFlickerMode<BLUE_FLICKER_PRESET>;
\ No newline at end of file
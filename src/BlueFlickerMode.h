@@ -2,56 +2,82 @@
 #define BLUE_FLICKER_MODE_H
 
 #include "LightingMode.h"
+#include "FixedMath.h"
+#include "LedConfig.h"
+#include "StarOverlay.h"
 
-class BlueFlickerMode : public LightingMode {
+// Conversion d'une vitesse en unités de force par ms vers FlickerLed::speed
+#define FLICKER_SPEED(unitsPerMs) ((uint16_t)((unitsPerMs) * 65536.0 * 256.0))
+
+// Réglages de BlueFlickerMode, évalués à la compilation : aucun n'occupe de RAM.
+// Les couples Low/High sont les valeurs pour un paramètre global de 0 et de 100.
+struct BlueFlickerClassic {
+    // Les probabilités et le pas de la marche aléatoire ont été réglés pour une mise à jour à chaque
+    // tour de la boucle libre d'origine, environ 8 ms sur Uno pour 10 LEDs (estimation : calcul
+    // flottant par LED, pow() compris, et show()). Ils sont ramenés à la durée de chaque trame.
+    static constexpr uint8_t updatePeriod = 8;               // ms
+    static constexpr float minLedSpeed = 0.0002;             // Unités de force par ms
+    static constexpr float maxLedSpeed = 0.001;
+    static constexpr float speedChangeProbability = 0.01;    // Par LED et par mise à jour
+    static constexpr uint16_t hueMin = 34768;                // 180 degrés (cyan)
+    static constexpr uint16_t hueMax = 51152;                // 270 degrés (violet)
+    static constexpr float intensityMin = 0.0025;
+    static constexpr float intensityMaxLow = 0.2;
+    static constexpr float intensityMaxHigh = 1.0;
+    static constexpr float intensityExponentLow = 2.0;       // Exposant de la conversion non linéaire
+    static constexpr float intensityExponentHigh = 3.0;
+
+    // Étoiles (durées et intensités de départ : voir StarOverlay)
+    static constexpr uint8_t maxStars = 2;                   // Étoiles simultanées au plus
+    static constexpr float starProbabilityLow = 0.00005;     // Par LED et par mise à jour
+    static constexpr float starProbabilityHigh = 0.000025;
+    static constexpr float starPeakLow = 0.5;                // Borne haute de l'intensité au sommet
+    static constexpr float starPeakHigh = 1.0;
+};
+
+template <typename Tuning>
+class TunedBlueFlickerMode : public LightingMode {
 public:
-    BlueFlickerMode(Adafruit_NeoPixel* strip, float* globalParam);
-    void update() override;
+    TunedBlueFlickerMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
     void reset() override;
 
 private:
-    // Variables spécifiques au mode scintillement bleu
-    static const int NUM_LEDS_FLICKER = 10;
-    float ledForce[NUM_LEDS_FLICKER];
-    float ledSpeed[NUM_LEDS_FLICKER];
-    unsigned long lastUpdateFlicker[NUM_LEDS_FLICKER];
-
-    // Variables pour l'oscillation aléatoire de la force
-    float ledMinForce[NUM_LEDS_FLICKER];
-    float ledMaxForce[NUM_LEDS_FLICKER];
-
-    // Paramètres pour le mode scintillement bleu
-    float minLedSpeed;
-    float maxLedSpeed;
-    float minLedForce;
-    float maxLedForce;
-    uint16_t hueMin;
-    uint16_t hueMax;
-    float intensityMin;
-    float intensityMax;
-    float intensityExponent;
-
-    // Variables pour le mode étoile
-    bool isStarMode[NUM_LEDS_FLICKER];
-    int maxStars;
-    float starProbability;
-    unsigned long starStartTime[NUM_LEDS_FLICKER];
-    unsigned long starDuration[NUM_LEDS_FLICKER];
-    float starMinIntensityStart;
-    float starMaxIntensityStart;
-    float starMinIntensityEnd;
-    float starMaxIntensityEnd;
-    unsigned long starMinRiseTime;
-    unsigned long starMaxRiseTime;
-    unsigned long starMinFallTime;
-    unsigned long starMaxFallTime;
-    float starCurrentIntensity[NUM_LEDS_FLICKER];
-    unsigned long starRiseTimeActual[NUM_LEDS_FLICKER];
-    unsigned long starFallTimeActual[NUM_LEDS_FLICKER];
-    float starMaxIntensityEndActual[NUM_LEDS_FLICKER];
-
-    // Fonction pour mettre à jour les LEDs en mode étoile
-    void updateStarMode(int index, unsigned long currentMillis);
+    // Constantes dérivées des réglages
+    static constexpr uint16_t minLedSpeed = FLICKER_SPEED(Tuning::minLedSpeed);  // Mêmes unités que FlickerLed::speed
+    static constexpr uint16_t maxLedSpeed = FLICKER_SPEED(Tuning::maxLedSpeed);
+    static constexpr uint32_t speedChangeThreshold =                               // Par ms
+        FastRandom::probability(Tuning::speedChangeProbability / Tuning::updatePeriod);
+    static constexpr unit16_t intensityMinUnit = unitFromFloat(Tuning::intensityMin);
+
+    // État compact d'une LED (virgule fixe). Toutes les LEDs avancent à chaque trame du même dt :
+    // aucun horodatage par LED.
+    struct FlickerLed {
+        unit16_t force;        // Force courante (0-1)
+        uint16_t speed;        // Vitesse en 1/256 d'unité unit16 par ms
+        uint8_t minForce;      // Borne basse individuelle de la force (0-255 = 0-1)
+        uint8_t maxForce;      // Borne haute individuelle de la force (0-255 = 0-1)
+    };
+    static_assert(sizeof(FlickerLed) <= 6, "FlickerLed doit tenir en 6 octets par LED");
+
+    FlickerLed ledStates[LED_COUNT];
+    EnvelopePool<Tuning::maxStars> starPool;
+    StarOverlay stars;                   // Étoiles blanches fusionnées par-dessus le scintillement
+
+    // Termes de la conversion d'intensité, dérivés du paramètre global
+    ParamWatch globalWatch;
+    q8_8_t exponent;
+    unit16_t intensityScale;
+
+    // Recalcule les valeurs dérivées du paramètre global
+    void applyParameters();
 };
 
+// Préréglage de BlueFlickerMode choisi à la compilation (-DBLUE_FLICKER_PRESET=...)
+#ifndef BLUE_FLICKER_PRESET
+#define BLUE_FLICKER_PRESET BlueFlickerClassic
+#endif
+
+typedef TunedBlueFlickerMode<BLUE_FLICKER_PRESET> BlueFlickerMode;
+
 #endif // BLUE_FLICKER_MODE_H
\ No newline at end of file
@@ -1,74 +1,163 @@
 #include "ButtonHandler.h"
+#include "Logger.h"
+
+ButtonHandler* ButtonHandler::instance = NULL;
 
 ButtonHandler::ButtonHandler(uint8_t pin) {
     buttonPin = pin;
-    buttonState = HIGH;
-    lastButtonState = HIGH;
-    lastDebounceTime = 0;
+    edgeOverflow = false;
+    queueOverflows = 0;
+    rawPressed = false;
+    rawEdgeTime = 0;
+    stablePressed = false;
     buttonPressedTime = 0;
-    isLongPress = false;
+    lastClickTime = 0;
+    clickPending = false;
     longPressActive = false;
+    nextRepeatTime = 0;
 }
 
 void ButtonHandler::begin() {
     pinMode(buttonPin, INPUT_PULLUP);
+    rawPressed = digitalRead(buttonPin) == LOW;
+    stablePressed = rawPressed;
+    rawEdgeTime = millis();
+
+    instance = this;
+    attachInterrupt(digitalPinToInterrupt(buttonPin), handleInterrupt, CHANGE);
+}
+
+void ButtonHandler::handleInterrupt() {
+    // Appelé en contexte d'interruption : horodatage et niveau seulement
+    instance->onEdge(millis(), digitalRead(instance->buttonPin) == LOW);
+}
+
+void ButtonHandler::onEdge(unsigned long time, bool pressed) {
+    ButtonEdge edge = { time, pressed };
+    if (!edges.push(edge)) {
+        edgeOverflow = true;
+    }
+}
+
+void ButtonHandler::poll() {
+    // Même producteur que l'interruption : la file n'en admet qu'un à la fois
+    noInterrupts();
+    onEdge(millis(), digitalRead(buttonPin) == LOW);
+    interrupts();
+}
+
+bool ButtonHandler::nextDeadline(unsigned long& deadline) const {
+    if (!edges.empty() || !events.empty()) {
+        deadline = millis(); // À traiter tout de suite
+    } else if (rawPressed != stablePressed) {
+        deadline = rawEdgeTime + debounceDelay + 1;
+    } else if (stablePressed) {
+        deadline = longPressActive ? nextRepeatTime : buttonPressedTime + longPressTime;
+    } else {
+        return false;
+    }
+    return true;
 }
 
 ButtonEvent ButtonHandler::update() {
-    ButtonEvent event = ButtonEvent::None;
-    bool reading = digitalRead(buttonPin);
+    ButtonEdge edge;
+    while (edges.pop(edge)) {
+        processEdge(edge);
+    }
+
+    unsigned long now = millis();
 
-    // Vérifier si l'état du bouton a changé (brut)
-    if (reading != lastButtonState) {
-        lastDebounceTime = millis();
+    // Fronts perdus : l'état réel de la broche fait foi
+    if (edgeOverflow) {
+        edgeOverflow = false;
+        queueOverflows++;
+        ButtonEdge current = { now, digitalRead(buttonPin) == LOW };
+        processEdge(current);
     }
 
-    // Si le temps de debounce est écoulé
-    if ((millis() - lastDebounceTime) > debounceDelay) {
-        // Si l'état stable du bouton a changé
-        if (reading != buttonState) {
-            buttonState = reading;
-
-            if (buttonState == LOW) {
-                // Bouton vient d'être pressé
-                buttonPressedTime = millis();
-                isLongPress = false;
-                longPressActive = false;
-                Serial.println("Bouton pressé");
-            } else {
-                // Bouton vient d'être relâché
-                unsigned long pressDuration = millis() - buttonPressedTime;
-
-                if (pressDuration >= longPressTime) {
-                    // Fin de l'appui long
-                    isLongPress = false;
-                    longPressActive = false;
-                    Serial.println("Fin de l'appui long");
-                    event = ButtonEvent::LongPressEnd;
-                } else {
-                    // Appui court détecté
-                    if (!isLongPress) {
-                        Serial.println("Appui court détecté");
-                        event = ButtonEvent::ShortPress;
-                    }
-                }
-            }
-        }
+    // Dernier niveau reçu stable depuis assez longtemps
+    if (now - rawEdgeTime > debounceDelay) {
+        commitLevel(rawPressed, rawEdgeTime);
+    }
 
+    if (stablePressed) {
         // Détection de l'appui long
-        if (buttonState == LOW && !isLongPress) {
-            unsigned long pressDuration = millis() - buttonPressedTime;
-
-            if (pressDuration >= longPressTime) {
-                // Appui long détecté
-                isLongPress = true;
-                longPressActive = true;
-                Serial.println("Appui long détecté (début de l'ajustement du paramètre)");
-                event = ButtonEvent::LongPressStart;
+        if (!longPressActive && now - buttonPressedTime >= longPressTime) {
+            longPressActive = true;
+            nextRepeatTime = buttonPressedTime + longPressTime + repeatInterval;
+            LOG(LOG_LEVEL_DEBUG, "Appui long détecté (début de l'ajustement du paramètre)");
+            emit(ButtonEvent::LongPressStart);
+        } else if (longPressActive && (long)(now - nextRepeatTime) >= 0) {
+            // Au plus une répétition par appel ; en cas de retard on repart de maintenant
+            nextRepeatTime += repeatInterval;
+            if ((long)(now - nextRepeatTime) >= 0) {
+                nextRepeatTime = now + repeatInterval;
             }
+            emit(ButtonEvent::HoldRepeat);
         }
     }
 
-    lastButtonState = reading;
+    ButtonEvent event = ButtonEvent::None;
+    events.pop(event);
     return event;
+}
+
+void ButtonHandler::processEdge(const ButtonEdge& edge) {
+    if (edge.pressed == rawPressed) {
+        return; // Rebond déjà absorbé ou front en double
+    }
+
+    // Le niveau précédent a tenu plus que le délai d'anti-rebond : il est validé à son propre instant
+    if (edge.time - rawEdgeTime > debounceDelay) {
+        commitLevel(rawPressed, rawEdgeTime);
+    }
+
+    rawPressed = edge.pressed;
+    rawEdgeTime = edge.time;
+}
+
+void ButtonHandler::commitLevel(bool pressed, unsigned long time) {
+    if (pressed == stablePressed) {
+        return;
+    }
+    stablePressed = pressed;
+
+    if (pressed) {
+        // Bouton vient d'être pressé
+        buttonPressedTime = time;
+        longPressActive = false;
+        LOG(LOG_LEVEL_DEBUG, "Bouton pressé");
+        return;
+    }
+
+    // Bouton vient d'être relâché
+    unsigned long pressDuration = time - buttonPressedTime;
+
+    if (pressDuration >= longPressTime) {
+        // Appui long relâché avant que update() ne l'ait vu commencer (boucle bloquée)
+        if (!longPressActive) {
+            emit(ButtonEvent::LongPressStart);
+        }
+        longPressActive = false;
+        clickPending = false;
+        LOG(LOG_LEVEL_DEBUG, "Fin de l'appui long");
+        emit(ButtonEvent::LongPressEnd);
+    } else {
+        // Appui court détecté
+        LOG(LOG_LEVEL_DEBUG, "Appui court détecté");
+        emit(ButtonEvent::ShortPress);
+
+        // Double clic : deuxième appui court commencé peu après la fin du premier
+        if (clickPending && buttonPressedTime - lastClickTime <= doubleClickTime) {
+            clickPending = false;
+            emit(ButtonEvent::DoubleClick);
+        } else {
+            clickPending = true;
+            lastClickTime = time;
+        }
+    }
+}
+
+void ButtonHandler::emit(ButtonEvent event) {
+    events.push(event); // File pleine : l'événement le plus récent est abandonné
 }
\ No newline at end of file
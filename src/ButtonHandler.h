@@ -2,31 +2,81 @@
 #define BUTTON_HANDLER_H
 
 #include <Arduino.h>
+#include "SpscQueue.h"
 
 // Énumération pour les événements du bouton
 enum class ButtonEvent {
     None,
     ShortPress,
     LongPressStart,
-    LongPressEnd
+    LongPressEnd,
+    DoubleClick,    // Deuxième appui court rapproché (émis après son ShortPress)
+    HoldRepeat      // Répétition périodique pendant un appui long
 };
 
+// Front du bouton horodaté par l'interruption
+struct ButtonEdge {
+    unsigned long time;
+    bool pressed;
+};
+
+// Gestionnaire de bouton sur interruption externe (INT0/INT1).
+// L'interruption ne fait qu'horodater les fronts dans une file ; l'anti-rebond et la machine
+// à états tournent dans update() sur ces horodatages. Un appui plus court qu'une trame
+// (show() long) n'est donc jamais perdu et les durées d'appui ne dépendent pas de la boucle.
+// Une seule instance (la routine d'interruption n'a pas d'argument).
 class ButtonHandler {
 public:
     ButtonHandler(uint8_t pin);
     void begin();
+
+    // Traite les fronts reçus et retourne le prochain événement (None s'il n'y en a pas)
     ButtonEvent update();
 
+    // Point d'entrée des fronts : appelé par l'interruption, ou directement pour rejouer une séquence
+    void onEdge(unsigned long time, bool pressed);
+
+    // Relit la broche et l'injecte comme front (front manqué par INT0 pendant un sommeil profond)
+    void poll();
+
+    // Prochaine échéance de la machine à états (fin d'anti-rebond, appui long, répétition) dans
+    // deadline. Retourne false si le bouton est au repos : seul un front peut alors le réveiller.
+    bool nextDeadline(unsigned long& deadline) const;
+
+    unsigned long getQueueOverflows() const { return queueOverflows; }
+
 private:
+    static ButtonHandler* instance;
+    static void handleInterrupt();
+
     uint8_t buttonPin;
-    bool buttonState;
-    bool lastButtonState;
-    unsigned long lastDebounceTime;
+    SpscQueue<ButtonEdge, 8> edges;
+    volatile bool edgeOverflow;          // File de fronts pleine : l'état brut sera relu
+    unsigned long queueOverflows;
+
+    // Anti-rebond sur les horodatages
+    bool rawPressed;                     // Dernier niveau reçu
+    unsigned long rawEdgeTime;           // Instant du dernier front reçu
+    bool stablePressed;                  // Niveau validé par l'anti-rebond
+
+    // Machine à états
     unsigned long buttonPressedTime;
+    unsigned long lastClickTime;         // Fin du dernier appui court
+    bool clickPending;                   // Un appui court peut encore devenir un double clic
+    bool longPressActive;
+    unsigned long nextRepeatTime;
+
+    // Événements en attente (plusieurs fronts peuvent être traités en un seul update())
+    SpscQueue<ButtonEvent, 4> events;
+
     const unsigned long debounceDelay = 50;
     const unsigned long longPressTime = 800;
-    bool isLongPress;
-    bool longPressActive;
+    const unsigned long doubleClickTime = 300;   // Écart maximal entre deux appuis courts
+    const unsigned long repeatInterval = 200;    // Période des HoldRepeat
+
+    void processEdge(const ButtonEdge& edge);
+    void commitLevel(bool pressed, unsigned long time);
+    void emit(ButtonEvent event);
 };
 
 #endif // BUTTON_HANDLER_H
\ No newline at end of file
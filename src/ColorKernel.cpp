@@ -0,0 +1,22 @@
+#include "ColorKernel.h"
+
+void hsvSpan(uint8_t* pixels, uint16_t count, const uint16_t* hue, const uint8_t* sat, const uint8_t* val) {
+    for (uint16_t i = 0; i < count; i++) {
+        hsvToPixel(pixels, hue[i], sat != NULL ? sat[i] : 255, val[i]);
+        pixels += LED_BYTES_PER_PIXEL;
+    }
+}
+
+void hsvRampSpan(uint8_t* pixels, uint16_t count, int8_t direction,
+                 uint16_t hueStart, uint32_t hueStep, uint8_t sat, const uint8_t* val) {
+    int8_t stride = direction < 0 ? -(int8_t)LED_BYTES_PER_PIXEL : LED_BYTES_PER_PIXEL;
+
+    // Teinte en Q16 pour accumuler le pas sans division
+    uint32_t hue = (uint32_t)hueStart << 16;
+
+    for (uint16_t i = 0; i < count; i++) {
+        hsvToPixel(pixels, hue >> 16, sat, val[i]);
+        hue += hueStep;
+        pixels += stride;
+    }
+}
\ No newline at end of file
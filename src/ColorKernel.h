@@ -0,0 +1,77 @@
+#ifndef COLOR_KERNEL_H
+#define COLOR_KERNEL_H
+
+#include <Arduino.h>
+#include "LedConfig.h"
+
+// Conversion HSV → RGB en entiers 8/16 bits, écrite directement dans le tampon de la bande
+// (ordre des couleurs de LED_TYPE). Résultats identiques à Adafruit_NeoPixel::ColorHSV().
+// La luminosité globale de la bande (setBrightness) n'est pas appliquée.
+
+// Écrit un pixel (pixel pointe sur le premier octet du pixel dans le tampon)
+inline void hsvToPixel(uint8_t* pixel, uint16_t hue, uint8_t sat, uint8_t val) {
+    uint8_t r, g, b;
+
+    // Teinte ramenée sur 0..1530 (six secteurs de 255), arrondie comme ColorHSV()
+    uint16_t h = ((uint32_t)hue * 1530UL + 32768UL) >> 16;
+
+    if (h < 510) {          // Rouge → vert
+        b = 0;
+        if (h < 255) {
+            r = 255;
+            g = h;
+        } else {
+            r = 510 - h;
+            g = 255;
+        }
+    } else if (h < 1020) {  // Vert → bleu
+        r = 0;
+        if (h < 765) {
+            g = 255;
+            b = h - 510;
+        } else {
+            g = 1020 - h;
+            b = 255;
+        }
+    } else if (h < 1530) {  // Bleu → rouge
+        g = 0;
+        if (h < 1275) {
+            r = h - 1020;
+            b = 255;
+        } else {
+            r = 255;
+            b = 1530 - h;
+        }
+    } else {                // Dernier demi-pas : rouge
+        r = 255;
+        g = 0;
+        b = 0;
+    }
+
+    // Saturation et valeur : (c * (sat + 1) / 256 + (255 - sat)) * (val + 1) / 256
+    uint16_t s1 = 1 + sat;
+    uint8_t s2 = 255 - sat;
+    uint16_t v1 = 1 + val;
+    pixel[LED_OFFSET_R] = ((((r * s1) >> 8) + s2) * v1) >> 8;
+    pixel[LED_OFFSET_G] = ((((g * s1) >> 8) + s2) * v1) >> 8;
+    pixel[LED_OFFSET_B] = ((((b * s1) >> 8) + s2) * v1) >> 8;
+}
+
+// Écrit un pixel RGB
+inline void rgbToPixel(uint8_t* pixel, uint8_t r, uint8_t g, uint8_t b) {
+    pixel[LED_OFFSET_R] = r;
+    pixel[LED_OFFSET_G] = g;
+    pixel[LED_OFFSET_B] = b;
+}
+
+// Remplit count pixels à partir de tableaux de teinte, saturation et valeur
+// (sat peut être NULL : saturation maximale)
+void hsvSpan(uint8_t* pixels, uint16_t count, const uint16_t* hue, const uint8_t* sat, const uint8_t* val);
+
+// Rampe de teinte : le pixel k reçoit la teinte hueStart + k * hueStep (hueStep en Q16, reboucle
+// modulo 65536), la saturation sat et la valeur val[k]. direction = -1 parcourt le tampon à rebours
+// depuis pixels (utile pour une rampe symétrique autour d'un point).
+void hsvRampSpan(uint8_t* pixels, uint16_t count, int8_t direction,
+                 uint16_t hueStart, uint32_t hueStep, uint8_t sat, const uint8_t* val);
+
+#endif // COLOR_KERNEL_H
\ No newline at end of file
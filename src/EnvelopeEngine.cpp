@@ -0,0 +1,118 @@
+#include "EnvelopeEngine.h"
+
+enum EnvelopeStage : uint8_t {
+    STAGE_ATTACK,
+    STAGE_HOLD,
+    STAGE_DECAY,
+    STAGE_DONE
+};
+
+// Valeur de la courbe pour une progression p (fractions unit16)
+static unit16_t envelopeCurve(EnvelopeCurve curve, unit16_t p) {
+    switch (curve) {
+    case CURVE_EASE_IN:
+        return unitMul(p, p);
+    case CURVE_EASE_OUT: {
+        unit16_t q = UNIT_ONE - p;
+        return UNIT_ONE - unitMul(q, q);
+    }
+    case CURVE_SMOOTH: {
+        // p²(3 - 2p) = p² + 2p²(1 - p)
+        unit16_t p2 = unitMul(p, p);
+        unit16_t tail = unitMul(p2, UNIT_ONE - p);
+        return unitAdd(p2, unitAdd(tail, tail));
+    }
+    default:
+        return p;
+    }
+}
+
+Envelope* EnvelopeEngine::start(const EnvelopeShape& shape, uint16_t tag) {
+    if (count == capacity) {
+        return NULL;
+    }
+    Envelope& envelope = slots[count];
+    envelope.shape = shape;
+    envelope.tag = tag;
+    if (!enterStage(envelope, STAGE_ATTACK)) {
+        return NULL; // Toutes les étapes sont de durée nulle
+    }
+    updateLevel(envelope);
+    count++;
+    return &envelope;
+}
+
+void EnvelopeEngine::advance(unsigned long dt) {
+    uint8_t i = 0;
+    while (i < count) {
+        Envelope& envelope = slots[i];
+        unsigned long left = dt;
+        bool running = true;
+
+        // Étapes terminées pendant dt : le temps restant passe à l'étape suivante
+        while (left >= envelope.remaining) {
+            left -= envelope.remaining;
+            if (!enterStage(envelope, envelope.stage + 1)) {
+                running = false;
+                break;
+            }
+        }
+
+        if (!running) {
+            // Enveloppe terminée : la dernière prend sa place, et sera traitée à ce même indice
+            slots[i] = slots[--count];
+            continue;
+        }
+
+        // left < remaining : la phase reste inférieure à 2^32
+        envelope.remaining -= left;
+        envelope.phase += envelope.step * (uint32_t)left;
+        updateLevel(envelope);
+        i++;
+    }
+}
+
+bool EnvelopeEngine::contains(uint16_t tag) const {
+    for (uint8_t i = 0; i < count; i++) {
+        if (slots[i].tag == tag) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EnvelopeEngine::enterStage(Envelope& envelope, uint8_t stage) {
+    for (; stage < STAGE_DONE; stage++) {
+        uint16_t duration = stage == STAGE_ATTACK ? envelope.shape.attack
+                          : stage == STAGE_HOLD ? envelope.shape.hold
+                          : envelope.shape.decay;
+        if (duration > 0) {
+            envelope.stage = stage;
+            envelope.remaining = duration;
+            envelope.phase = 0;
+            envelope.step = 0xFFFFFFFFUL / duration; // Seule division, une fois par étape
+            return true;
+        }
+    }
+    envelope.stage = STAGE_DONE;
+    return false;
+}
+
+void EnvelopeEngine::updateLevel(Envelope& envelope) {
+    unit16_t progress = envelope.phase >> 16;
+    const EnvelopeShape& shape = envelope.shape;
+
+    switch (envelope.stage) {
+    case STAGE_ATTACK:
+        envelope.level = lerp8(shape.startLevel, shape.peakLevel,
+                               unitTo8(envelopeCurve(shape.attackCurve, progress)));
+        break;
+    case STAGE_HOLD:
+        envelope.level = shape.peakLevel;
+        break;
+    default:
+        envelope.level = lerp8(shape.peakLevel, 0,
+                               unitTo8(envelopeCurve(shape.decayCurve, progress)));
+        break;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#ifndef ENVELOPE_ENGINE_H
+#define ENVELOPE_ENGINE_H
+
+#include <Arduino.h>
+#include "FixedMath.h"
+
+// Courbes de transition d'une étape d'enveloppe (progression p de 0 à 1)
+enum EnvelopeCurve : uint8_t {
+    CURVE_LINEAR,      // p
+    CURVE_EASE_IN,     // p² : départ lent
+    CURVE_EASE_OUT,    // 1 - (1 - p)² : arrivée lente
+    CURVE_SMOOTH       // p²(3 - 2p) : lent aux deux extrémités
+};
+
+// Forme d'une impulsion : montée de startLevel à peakLevel, maintien, puis descente vers 0.
+// Une étape de durée nulle est sautée.
+struct EnvelopeShape {
+    uint16_t attack;           // Durée de montée (ms)
+    uint16_t hold;             // Durée du maintien au sommet (ms)
+    uint16_t decay;            // Durée de descente (ms)
+    uint8_t startLevel;        // Niveau de départ (0-255)
+    uint8_t peakLevel;         // Niveau au sommet (0-255)
+    EnvelopeCurve attackCurve;
+    EnvelopeCurve decayCurve;
+};
+
+// Enveloppe en cours. La progression dans l'étape est un accumulateur de phase :
+// l'incrément par ms est calculé une seule fois à l'entrée de l'étape, puis chaque
+// trame ne coûte qu'une multiplication, sans division.
+struct Envelope {
+    EnvelopeShape shape;
+    uint32_t phase;            // Progression dans l'étape (2^32 = étape terminée)
+    uint32_t step;             // Incrément de phase par ms
+    uint16_t remaining;        // Durée restante de l'étape (ms)
+    uint16_t tag;              // Identifiant libre choisi par l'appelant (LED, ...)
+    uint8_t stage;             // Étape courante
+    uint8_t level;             // Niveau courant (0-255)
+};
+
+// Ensemble d'enveloppes actives rangées de façon contiguë : advance() ne parcourt que
+// les enveloppes actives, et une enveloppe terminée est remplacée par la dernière.
+// Le stockage est fourni par EnvelopePool<N> ; l'ordre des enveloppes n'est pas stable.
+class EnvelopeEngine {
+public:
+    EnvelopeEngine(Envelope* storage, uint8_t capacity) : slots(storage), capacity(capacity), count(0) {}
+
+    // Démarre une enveloppe au niveau startLevel. Retourne NULL si le stockage est plein
+    // ou si toutes les étapes sont de durée nulle.
+    Envelope* start(const EnvelopeShape& shape, uint16_t tag);
+
+    // Fait avancer toutes les enveloppes de dt ms et retire celles qui sont terminées
+    void advance(unsigned long dt);
+
+    // Vrai si une enveloppe active porte ce tag (parcours des seules enveloppes actives)
+    bool contains(uint16_t tag) const;
+
+    void clear() { count = 0; }
+    bool full() const { return count == capacity; }
+    uint8_t active() const { return count; }
+    const Envelope& operator[](uint8_t index) const { return slots[index]; }
+
+private:
+    Envelope* slots;
+    uint8_t capacity;
+    uint8_t count;
+
+    // Entre dans l'étape stage (ou la suivante de durée non nulle). Retourne false après la dernière.
+    static bool enterStage(Envelope& envelope, uint8_t stage);
+    static void updateLevel(Envelope& envelope);
+};
+
+// Stockage de N enveloppes (N ≤ 255)
+template <uint8_t N>
+class EnvelopePool : public EnvelopeEngine {
+public:
+    EnvelopePool() : EnvelopeEngine(storage, N) {}
+
+private:
+    Envelope storage[N];
+};
+
+#endif // ENVELOPE_ENGINE_H
\ No newline at end of file
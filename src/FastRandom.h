@@ -0,0 +1,85 @@
+#ifndef FAST_RANDOM_H
+#define FAST_RANDOM_H
+
+#include <stdint.h>
+#include "FixedMath.h"
+
+// Générateur pseudo-aléatoire xorshift32 (période 2^32 - 1) : décalages et XOR uniquement,
+// sans modulo ni division. Chaque mode possède son propre flux, ensemençable pour rejouer
+// une animation à l'identique.
+// La graine passée au constructeur est mêlée à l'entropie globale (addEntropy) : nulle par
+// défaut, les flux sont reproductibles (banc, simulateur, tests) ; le firmware y ajoute un bruit
+// de démarrage pour que chaque mise sous tension donne une animation différente.
+class FastRandom {
+public:
+    explicit FastRandom(uint32_t seed = defaultSeed) { this->seed(seed ^ entropy()); }
+
+    // Mêle value à l'entropie des flux construits ensuite
+    static void addEntropy(uint32_t value) {
+        uint32_t x = (entropy() ^ value) * 2654435761UL;   // Hachage multiplicatif (Knuth)
+        entropy() = x ^ (x >> 16);
+    }
+
+    // L'état nul est un point fixe de xorshift : il est remplacé par la graine par défaut
+    void seed(uint32_t value) {
+        state = value;
+        if (state == 0) {
+            state = defaultSeed;
+        }
+    }
+
+    uint32_t next() {
+        uint32_t x = state;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        state = x;
+        return x;
+    }
+
+    uint16_t next16() { return next() >> 16; }
+    uint8_t next8() { return next() >> 24; }
+
+    // Entier dans [0, n) par multiplication (n ≤ 65535)
+    uint16_t below(uint16_t n) { return ((uint32_t)next16() * n) >> 16; }
+
+    // Entier dans [min, max) (max - min ≤ 65535), équivalent de random(min, max)
+    long range(long min, long max) { return max > min ? min + below((uint16_t)(max - min)) : min; }
+
+    // Fraction dans [0, 1)
+    unit16_t unit() { return next16(); }
+
+    // Flottant dans [min, max) pour l'initialisation et les événements rares
+    float uniform(float min, float max) { return min + (next16() / 65536.0f) * (max - min); }
+
+    // Pile ou face
+    bool coin() { return (int32_t)next() < 0; }
+
+    // Vrai avec une probabilité threshold / 2^32 (voir probability())
+    bool chance(uint32_t threshold) { return next() < threshold; }
+
+    // Seuil de chance() sur count unités de temps d'après le seuil perUnit d'une unité, saturé.
+    // Pour une probabilité faible, p × n approche 1 - (1 - p)^n.
+    static uint32_t scaledThreshold(uint32_t perUnit, uint32_t count) {
+        return count != 0 && perUnit > 0xFFFFFFFFUL / count ? 0xFFFFFFFFUL : perUnit * count;
+    }
+
+    // Seuil de chance() pour une probabilité p dans [0, 1]. Le produit est borné avant conversion :
+    // 2^32 n'entre pas dans un uint32_t (comportement indéfini) et un p juste sous 1 peut y être
+    // arrondi selon la précision du calcul.
+    static constexpr uint32_t probability(float p) {
+        return p <= 0.0f ? 0 : (p * 4294967296.0f >= 4294967295.0f ? 0xFFFFFFFFUL : (uint32_t)(p * 4294967296.0f));
+    }
+
+private:
+    static const uint32_t defaultSeed = 2463534242UL;
+    uint32_t state;
+
+    // Variable statique de fonction : définie une seule fois malgré l'inclusion multiple
+    static uint32_t& entropy() {
+        static uint32_t value = 0;
+        return value;
+    }
+};
+
+#endif // FAST_RANDOM_H
\ No newline at end of file
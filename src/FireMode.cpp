@@ -0,0 +1,102 @@
+#include "FireMode.h"
+#include "Utils.h"
+#include "LookupTables.h"
+#include "ColorKernel.h"
+
+template <typename Tuning>
+TunedFireMode<Tuning>::TunedFireMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment)
+    : LightingMode(strip, parameterBank, ledSegment, 0xF12E0B5DUL), globalWatch(PARAM_GLOBAL) {
+    // Zone d'étincelles : ne dépend que de la longueur du segment
+    sparkZone = ((uint32_t)segment.length * Tuning::sparkZonePercent) / 100;
+    if (sparkZone == 0) {
+        sparkZone = 1;
+    }
+
+    coolingMax = 2;
+    sparking = Tuning::sparkingLow;
+    reset();
+}
+
+template <typename Tuning>
+void TunedFireMode<Tuning>::renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) {
+    (void)now;
+
+    // Variables dépendantes du paramètre global, recalculées seulement s'il a changé
+    if (globalWatch.changed(*parameters)) {
+        applyParameters();
+    }
+
+    // Avancer la simulation d'un nombre entier de pas ; au-delà du maximum, le retard est abandonné
+    stepClock += dt > 0xFFFF ? 0xFFFF : (uint16_t)dt;
+    uint8_t steps = 0;
+    while (stepClock >= Tuning::stepTime && steps < Tuning::maxStepsPerFrame) {
+        stepClock -= Tuning::stepTime;
+        step();
+        steps++;
+    }
+    if (stepClock >= Tuning::stepTime) {
+        stepClock = 0;
+    }
+
+    // Chaleur vers couleur par la palette en flash
+    uint8_t* pixel = span.data;
+    for (uint16_t i = 0; i < span.length; i++, pixel += span.stride) {
+        uint8_t r, g, b;
+        lutFire(heat[i], r, g, b);
+        rgbToPixel(pixel, r, g, b);
+    }
+}
+
+template <typename Tuning>
+void TunedFireMode<Tuning>::reset() {
+    // Feu éteint : il reprend à partir des étincelles
+    for (uint16_t i = 0; i < segment.length; i++) {
+        heat[i] = 0;
+    }
+    stepClock = 0;
+}
+
+template <typename Tuning>
+void TunedFireMode<Tuning>::applyParameters() {
+    float globalParameter = parameters->get(PARAM_GLOBAL);
+    uint8_t cooling = mapf(globalParameter, 0.0, 100.0, Tuning::coolingLow, Tuning::coolingHigh);
+    sparking = mapf(globalParameter, 0.0, 100.0, Tuning::sparkingLow, Tuning::sparkingHigh);
+
+    // Seule division dépendant de la longueur, faite une fois par changement de paramètre.
+    // Segment très court (jusqu'à 3 LEDs) : la borne dépasse 255, plafonnée (refroidissement total).
+    uint16_t bound = segment.length > 0 ? ((uint16_t)cooling * 10) / segment.length + 2 : 2;
+    coolingMax = bound > 255 ? 255 : bound;
+}
+
+template <typename Tuning>
+void TunedFireMode<Tuning>::step() {
+    uint16_t length = segment.length;
+
+    // 1. Refroidissement : un octet aléatoire par cellule, quatre cellules par tirage
+    uint32_t bits = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        if ((i & 3) == 0) {
+            bits = rng.next();
+        }
+        uint8_t cooldown = ((uint16_t)(uint8_t)bits * coolingMax) >> 8;
+        bits >>= 8;
+        heat[i] = heat[i] > cooldown ? heat[i] - cooldown : 0;
+    }
+
+    // 2. Diffusion vers le haut, du sommet vers la base pour lire les cellules du dessous avant
+    //    leur mise à jour : (dessous-2 + 2 * dessous + soi) / 4, la cellule 1 étant nourrie par la base
+    for (uint16_t k = length; k-- > 1;) {
+        uint8_t below2 = k >= 2 ? heat[k - 2] : heat[k - 1];
+        heat[k] = ((uint16_t)below2 + 2 * heat[k - 1] + heat[k]) >> 2;
+    }
+
+    // 3. Étincelle aléatoire dans la zone de base
+    if (rng.next8() < sparking) {
+        uint16_t y = rng.below(sparkZone);
+        uint16_t sum = heat[y] + rng.range(Tuning::sparkHeatMin, Tuning::sparkHeatMax + 1);
+        heat[y] = sum > 255 ? 255 : sum;
+    }
+}
+
+// Seul le préréglage retenu à la compilation est instancié
+template class TunedFireMode<FIRE_PRESET>;
\ No newline at end of file
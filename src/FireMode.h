@@ -0,0 +1,59 @@
+#ifndef FIRE_MODE_H
+#define FIRE_MODE_H
+
+#include "LightingMode.h"
+#include "LedConfig.h"
+
+// Réglages de FireMode, évalués à la compilation : aucun n'occupe de RAM.
+// Les couples Low/High sont les valeurs pour un paramètre global de 0 et de 100.
+struct FireClassic {
+    // Pas de simulation indépendant de la cadence des trames
+    static constexpr uint8_t stepTime = 16;                  // ms par pas (~60 pas/s)
+    static constexpr uint8_t maxStepsPerFrame = 4;           // Rattrapage borné après une longue trame
+
+    // Refroidissement : une cellule perd jusqu'à cooling * 10 / longueur + 2 par pas (au plus 255).
+    // Plus il est fort, plus la flamme est courte ; la hauteur relative ne dépend pas de la longueur.
+    static constexpr uint8_t coolingLow = 90;
+    static constexpr uint8_t coolingHigh = 50;
+
+    // Étincelles à la base : probabilité par pas (sur 256) et zone (pourcentage de la longueur)
+    static constexpr uint8_t sparkingLow = 50;
+    static constexpr uint8_t sparkingHigh = 140;
+    static constexpr uint8_t sparkZonePercent = 12;
+    static constexpr uint8_t sparkHeatMin = 160;             // Chaleur ajoutée par une étincelle
+    static constexpr uint8_t sparkHeatMax = 255;
+};
+
+// Feu par diffusion de chaleur : chaque LED est une cellule de chaleur 8 bits qui refroidit,
+// transmet sa chaleur vers le haut et reçoit des étincelles aléatoires à la base (index 0).
+// La couleur vient d'une palette en flash reprenant les zones rouge, orange et blanche de
+// FlameMode. Arithmétique entière uniquement, sans division dans la boucle des cellules.
+template <typename Tuning>
+class TunedFireMode : public LightingMode {
+public:
+    TunedFireMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
+    void reset() override;
+
+private:
+    uint8_t heat[LED_COUNT];             // Chaleur de chaque cellule (0-255)
+    uint16_t stepClock;                  // Temps accumulé pas encore simulé (ms)
+
+    // Dérivés du paramètre global et de la longueur du segment
+    ParamWatch globalWatch;
+    uint8_t coolingMax;                  // Borne (exclue) du refroidissement par cellule et par pas
+    uint8_t sparking;                    // Probabilité d'étincelle par pas (sur 256)
+    uint16_t sparkZone;                  // Nombre de cellules de la base pouvant recevoir une étincelle
+
+    void applyParameters();
+    void step();
+};
+
+// Préréglage de FireMode choisi à la compilation (-DFIRE_PRESET=...)
+#ifndef FIRE_PRESET
+#define FIRE_PRESET FireClassic
+#endif
+
+typedef TunedFireMode<FIRE_PRESET> FireMode;
+
+#endif // FIRE_MODE_H
\ No newline at end of file
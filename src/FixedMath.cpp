@@ -0,0 +1,73 @@
+#include "FixedMath.h"
+
+// Coefficients en Q15 obtenus par moindres carrés sur [0, 1], extrémités exactes
+// log2(1 + f) ≈ f * (A + f * (B + C * f))
+static const int32_t LOG2_A = 46559;
+static const int32_t LOG2_B = -18915;
+static const int32_t LOG2_C = 5124;
+
+// 2^-f ≈ 1 + f * (A + f * (B + C * f))
+static const int32_t EXP2_A = -22663;
+static const int32_t EXP2_B = 7575;
+static const int32_t EXP2_C = -1296;
+
+unit16_t powUnit(unit16_t x, q8_8_t k) {
+    if (k <= 0 || x == UNIT_ONE) {
+        return UNIT_ONE;
+    }
+    if (x == 0) {
+        return 0;
+    }
+
+    // Normalisation : x = m * 2^-(e + 1) avec m / 32768 dans [1, 2)
+    uint8_t e = 0;
+    uint16_t m = x;
+    while (!(m & 0x8000)) {
+        m <<= 1;
+        e++;
+    }
+
+    // log2(m / 32768) en Q15
+    int32_t f = (int32_t)m - 32768;
+    int32_t t = LOG2_C;
+    t = ((t * f) >> 15) + LOG2_B;
+    t = ((t * f) >> 15) + LOG2_A;
+    int32_t mantissaLog = (t * f) >> 15;
+
+    // -log2(x) en Q15, puis multiplication par k (Q8.8) : y = -k * log2(x) en Q15
+    uint32_t negLog = ((uint32_t)(e + 1) << 15) - (uint32_t)mantissaLog;
+    uint32_t y = (negLog * (uint16_t)k) >> 8;
+
+    uint32_t shift = y >> 15;
+    if (shift >= 16) {
+        return 0;
+    }
+
+    // 2^-y = 2^-frac(y) >> ent(y)
+    int32_t yf = y & 0x7FFF;
+    t = EXP2_C;
+    t = ((t * yf) >> 15) + EXP2_B;
+    t = ((t * yf) >> 15) + EXP2_A;
+    uint32_t p = 32768 + ((t * yf) >> 15); // Q15 dans [16384, 32768]
+
+    uint32_t r = (p << 1) >> shift;
+    return r > UNIT_ONE ? UNIT_ONE : (unit16_t)r;
+}
+
+uint16_t sqrtU32(uint32_t x) {
+    uint32_t root = 0;
+    uint32_t bit = 1UL << 30;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (uint16_t)root;
+}
\ No newline at end of file
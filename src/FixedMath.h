@@ -0,0 +1,115 @@
+#ifndef FIXED_MATH_H
+#define FIXED_MATH_H
+
+#include <stdint.h>
+
+// Calcul en virgule fixe pour les chemins de rendu (l'ATmega328P n'a pas d'unité flottante)
+//
+// q8_8_t    : 8 bits entiers, 8 bits fractionnaires (signé), 1.0 = 256
+// q16_16_t  : 16 bits entiers, 16 bits fractionnaires (signé), 1.0 = 65536
+// unit16_t  : fraction de l'intervalle [0, 1], 1.0 = UNIT_ONE (65535)
+// Phase     : uint16_t, un tour complet (2π) = 65536
+
+typedef int16_t q8_8_t;
+typedef int32_t q16_16_t;
+typedef uint16_t unit16_t;
+
+const unit16_t UNIT_ONE = 65535;
+const q8_8_t Q8_8_ONE = 256;
+const q16_16_t Q16_16_ONE = 65536L;
+
+// Bornes de saturation (INT16_MAX & co ne sont pas garantis en C++ avec avr-libc)
+const q8_8_t Q8_8_MAX = 32767;
+const q8_8_t Q8_8_MIN = -32767 - 1;
+const q16_16_t Q16_16_MAX = 2147483647L;
+const q16_16_t Q16_16_MIN = -2147483647L - 1;
+
+// Conversions depuis les flottants (à réserver à l'initialisation ou à un calcul par trame).
+// constexpr : appliquées à une constante de réglage, elles sont évaluées à la compilation.
+constexpr q8_8_t q88FromFloat(float x) {
+    return (q8_8_t)(x * 256.0f + (x >= 0 ? 0.5f : -0.5f));
+}
+
+constexpr q16_16_t q1616FromFloat(float x) {
+    return (q16_16_t)(x * 65536.0f + (x >= 0 ? 0.5f : -0.5f));
+}
+
+constexpr unit16_t unitFromFloat(float x) {
+    return x <= 0.0f ? 0 : (x >= 1.0f ? UNIT_ONE : (unit16_t)(x * 65535.0f + 0.5f));
+}
+
+inline float unitToFloat(unit16_t x) {
+    return x / 65535.0f;
+}
+
+// Arithmétique saturante
+inline q8_8_t q88Add(q8_8_t a, q8_8_t b) {
+    int16_t r = (int16_t)((uint16_t)a + (uint16_t)b);
+    // Débordement si a et b ont le même signe et que le résultat change de signe
+    if (((a ^ r) & (b ^ r)) < 0) {
+        return a < 0 ? Q8_8_MIN : Q8_8_MAX;
+    }
+    return r;
+}
+
+inline q8_8_t q88Mul(q8_8_t a, q8_8_t b) {
+    int32_t r = ((int32_t)a * b) >> 8;
+    if (r > Q8_8_MAX) return Q8_8_MAX;
+    if (r < Q8_8_MIN) return Q8_8_MIN;
+    return (q8_8_t)r;
+}
+
+inline q16_16_t q1616Add(q16_16_t a, q16_16_t b) {
+    int32_t r = (int32_t)((uint32_t)a + (uint32_t)b);
+    if (((a ^ r) & (b ^ r)) < 0) {
+        return a < 0 ? Q16_16_MIN : Q16_16_MAX;
+    }
+    return r;
+}
+
+inline q16_16_t q1616Mul(q16_16_t a, q16_16_t b) {
+    int64_t r = ((int64_t)a * b) >> 16;
+    if (r > Q16_16_MAX) return Q16_16_MAX;
+    if (r < Q16_16_MIN) return Q16_16_MIN;
+    return (q16_16_t)r;
+}
+
+// Produit de deux fractions (UNIT_ONE est l'élément neutre)
+inline unit16_t unitMul(unit16_t a, unit16_t b) {
+    return (unit16_t)(((uint32_t)a * b + a) >> 16);
+}
+
+// Somme de deux fractions, saturée à UNIT_ONE
+inline unit16_t unitAdd(unit16_t a, unit16_t b) {
+    uint32_t r = (uint32_t)a + b;
+    return r > UNIT_ONE ? UNIT_ONE : (unit16_t)r;
+}
+
+// Interpolations linéaires sans division : t = 0 donne a, t maximal donne exactement b
+inline uint8_t lerp8(uint8_t a, uint8_t b, uint8_t t) {
+    return (uint8_t)(a + ((((int16_t)b - a) * (int16_t)(t + (t >> 7))) >> 8));
+}
+
+inline uint16_t lerp16(uint16_t a, uint16_t b, unit16_t t) {
+    if (t == UNIT_ONE) return b;
+    return (uint16_t)(a + ((((int32_t)b - a) * (int32_t)(t >> 1)) >> 15));
+}
+
+inline q16_16_t q1616Lerp(q16_16_t a, q16_16_t b, unit16_t t) {
+    if (t == UNIT_ONE) return b;
+    return a + (q16_16_t)(((int64_t)(b - a) * t) >> 16);
+}
+
+// Conversion d'une fraction en valeur 8 bits (0 à 255)
+inline uint8_t unitTo8(unit16_t x) {
+    return (uint8_t)(x >> 8);
+}
+
+// x^k pour x dans [0, 1] et un exposant k en Q8.8 dans [0, 16)
+// Approximation par log2/exp2 polynomiaux (erreur relative < 0,5 % pour k ≤ 4)
+unit16_t powUnit(unit16_t x, q8_8_t k);
+
+// Racine carrée entière (partie entière), bit à bit : 16 itérations sans multiplication
+uint16_t sqrtU32(uint32_t x);
+
+#endif // FIXED_MATH_H
\ No newline at end of file
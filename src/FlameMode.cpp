@@ -1,48 +1,50 @@
 #include "FlameMode.h"
 #include "Utils.h"
-#include <math.h>
-
-FlameMode::FlameMode(Adafruit_NeoPixel* strip, float* globalParam) 
-    : LightingMode(strip, globalParam) {
-    // Initialisation des variables spécifiques au mode flamme
-    globalStrength = 0.5;
-    strengthIncrement = 0.25;
-    minStrengthIncrement = 0.05;
-    maxStrengthIncrement = 0.15;
-    nextStrengthChange = 0;
-    minStrengthChangeInterval = 1000;
-    maxStrengthChangeInterval = 3000;
-
-    globalForceMin = 0.05;
-    globalForceMax = 2.5;
-    nextForceRangeChange = 0;
-    minForceRangeChangeInterval = 2000;
-    maxForceRangeChangeInterval = 5000;
-
-    forceCurveExponent = 1.5;
-    orangeZoneStart = 0.1;
-    orangeZoneEnd = 0.9;
-
-    previousMillis = 0;
-    currentMillis = 0;
+#include "LookupTables.h"
+#include "ColorKernel.h"
+
+template <typename Tuning>
+TunedFlameMode<Tuning>::TunedFlameMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment) 
+    : LightingMode(strip, parameterBank, ledSegment, 0xF1A3E5D7UL), globalWatch(PARAM_GLOBAL) {
+    // Initialisation des variables spécifiques au mode flamme (réglages : voir FlameClassic)
+    strengthPhase = Tuning::initialStrengthPhase;
+    strengthIncrement = Tuning::initialStrengthIncrement;
+
+    globalForceMin = Tuning::initialForceMin;
+    globalForceMax = Tuning::initialForceMax;
+
+    currentMillis = millis();
+
+    // Profil spatial construit à la première trame
+    profileValid = false;
 
     scheduleNextStrengthChange();
     scheduleNextForceRangeChange();
 }
 
-void FlameMode::update() {
-    currentMillis = millis();
+template <typename Tuning>
+void TunedFlameMode<Tuning>::renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) {
+    currentMillis = now;
 
-    if (currentMillis - previousMillis >= (unsigned long)interval) {
-        previousMillis = currentMillis;
+    // Mettre à jour globalForceMax si le paramètre global a changé
+    if (globalWatch.changed(*parameters)) {
+        globalForceMax = mapf(parameters->get(PARAM_GLOBAL), 0.0, 100.0, Tuning::forceMaxLow, Tuning::forceMaxHigh);
+    }
 
-        // Mettre à jour globalForceMax en fonction du globalParameter
-        globalForceMax = mapf(*globalParameter, 0.0, 100.0, 0.2, 2.5);
+    // Mettre à jour la phase de la force globale (incrément défini pour un pas de référence, mis à l'échelle par dt)
+    // L'accumulateur 16 bits reboucle naturellement sur 2π
+    strengthPhase += (uint16_t)(((uint32_t)strengthIncrement * dt) / Tuning::referenceStepTime);
 
-        // Vérifier s'il est temps de changer les valeurs min et max de la force globale
-        if (currentMillis >= nextForceRangeChange) {
+    // Changements programmés arrivés à échéance (une seule comparaison s'il n'y en a aucun)
+    uint8_t timer;
+    while (timers.poll(currentMillis, timer)) {
+        if (timer == TIMER_STRENGTH) {
+            // Changer la vitesse de variation
+            strengthIncrement = rng.range(Tuning::minStrengthIncrement, Tuning::maxStrengthIncrement);
+            scheduleNextStrengthChange();
+        } else {
             // Générer de nouvelles valeurs pour globalForceMin
-            globalForceMin = randomFloat(0.1, 0.5);  // Valeurs min entre 0.1 et 0.5
+            globalForceMin = rng.uniform(Tuning::forceMinLow, Tuning::forceMinHigh);
 
             // S'assurer que globalForceMin est inférieur à globalForceMax
             if (globalForceMin >= globalForceMax - 0.1) {
@@ -51,63 +53,72 @@ void FlameMode::update() {
 
             scheduleNextForceRangeChange();
         }
+    }
 
-        // Mettre à jour la force globale
-        globalStrength += strengthIncrement;
-        if (globalStrength > TWO_PI) {
-            globalStrength -= TWO_PI;
-        }
-
-        // Vérifier s'il est temps de changer la vitesse de variation
-        if (currentMillis >= nextStrengthChange) {
-            strengthIncrement = randomFloat(minStrengthIncrement, maxStrengthIncrement);
-            scheduleNextStrengthChange();
-        }
-
-        // Calculer la force globale oscillant entre globalForceMin et globalForceMax
-        float sinValue = (sin(globalStrength) + 1.0) / 2.0;  // Valeur entre 0 et 1
-        float globalForce = globalForceMin + sinValue * (globalForceMax - globalForceMin);
-
-        // Calculer la force pour chaque LED
-        for (unsigned int i = 0; i < leds->numPixels(); i++) {
-            float position = (float)i / (leds->numPixels() - 1);  // Position normalisée entre 0 et 1
-            position = 1.0 - position;  // Inverser pour que la base soit à 0
-
-            // Appliquer la courbe de force avec l'exposant
-            float ledForce = pow(position, forceCurveExponent);
+    // Calculer la force globale (Q8.8) oscillant entre globalForceMin et globalForceMax
+    q8_8_t forceMin = q88FromFloat(globalForceMin);
+    q8_8_t forceMax = q88FromFloat(globalForceMax);
+    unit16_t sinValue = lutSinUnit(strengthPhase);  // Valeur entre 0 et 1
+    q8_8_t globalForce = forceMin + (q8_8_t)(((int32_t)(forceMax - forceMin) * sinValue) >> 16);
+    if (globalForce < 0) {
+        globalForce = 0;
+    }
 
-            // Appliquer la force globale
-            ledForce *= globalForce;
+    // Profil spatial : ne dépend que de l'index (l'exposant est une constante de réglage)
+    if (!profileValid) {
+        rebuildForceProfile();
+    }
 
-            // Déterminer la couleur et l'intensité
-            setLEDColorFlame(i, ledForce);
+    // Calculer la force pour chaque LED
+    uint8_t* pixel = span.data;
+    for (uint16_t i = 0; i < span.length; i++, pixel += span.stride) {
+        // Appliquer la force globale à la courbe précalculée et limiter entre 0 et 1
+        uint32_t ledForce = ((uint32_t)forceProfile[i] * globalForce) >> 8;
+        if (ledForce > UNIT_ONE) {
+            ledForce = UNIT_ONE;
         }
 
-        leds->show();
+        // Déterminer la couleur et l'intensité
+        setLEDColorFlame(pixel, (unit16_t)ledForce);
     }
 }
 
-void FlameMode::reset() {
+template <typename Tuning>
+void TunedFlameMode<Tuning>::reset() {
     // Réinitialiser les variables si nécessaire
     // Aucun paramètre spécifique à réinitialiser pour le mode Flame
 }
 
-void FlameMode::scheduleNextStrengthChange() {
-    unsigned long intervalRandom = random(minStrengthChangeInterval, maxStrengthChangeInterval);
-    nextStrengthChange = currentMillis + intervalRandom;
+template <typename Tuning>
+void TunedFlameMode<Tuning>::rebuildForceProfile() {
+    profileValid = true;
+
+    uint16_t lastIndex = segment.length > 1 ? segment.length - 1 : 1;
+    for (uint16_t i = 0; i < segment.length; i++) {
+        // Position normalisée entre 0 et 1, inversée pour que la base soit à 1
+        unit16_t position = ((uint32_t)(lastIndex - i) * UNIT_ONE) / lastIndex;
+
+        // Appliquer la courbe de force avec l'exposant
+        forceProfile[i] = lutPowUnit(position, forceCurveExponent);
+    }
 }
 
-void FlameMode::scheduleNextForceRangeChange() {
-    unsigned long intervalRandom = random(minForceRangeChangeInterval, maxForceRangeChangeInterval);
-    nextForceRangeChange = currentMillis + intervalRandom;
+template <typename Tuning>
+void TunedFlameMode<Tuning>::scheduleNextStrengthChange() {
+    unsigned long intervalRandom = rng.range(Tuning::minStrengthChangeInterval, Tuning::maxStrengthChangeInterval);
+    timers.scheduleIn(TIMER_STRENGTH, currentMillis, intervalRandom);
 }
 
-void FlameMode::setLEDColorFlame(int index, float force) {
-    // Limiter la force entre 0 et 1
-    force = constrain(force, 0.0, 1.0);
+template <typename Tuning>
+void TunedFlameMode<Tuning>::scheduleNextForceRangeChange() {
+    unsigned long intervalRandom = rng.range(Tuning::minForceRangeChangeInterval, Tuning::maxForceRangeChangeInterval);
+    timers.scheduleIn(TIMER_FORCE_RANGE, currentMillis, intervalRandom);
+}
 
+template <typename Tuning>
+void TunedFlameMode<Tuning>::setLEDColorFlame(uint8_t* pixel, unit16_t force) {
     // Calculer l'intensité (brightness)
-    uint8_t brightness = (uint8_t)(force * 255);
+    uint8_t brightness = unitTo8(force);
 
     // Déterminer la couleur en fonction de la force avec les paramètres
     uint8_t r, g, b;
@@ -116,24 +127,27 @@ void FlameMode::setLEDColorFlame(int index, float force) {
         // Zone chaude, proche du blanc
         r = 255;
         g = 255;
-        b = (uint8_t)(200 * (1.0 - force));  // Légère teinte bleue diminuant avec la force
+        b = (uint8_t)((200UL * (UNIT_ONE - force)) >> 16);  // Légère teinte bleue diminuant avec la force
     } else if (force >= orangeZoneStart) {
         // Zone orange
-        float ratio = (force - orangeZoneStart) / (orangeZoneEnd - orangeZoneStart);
         r = 255;
-        g = (uint8_t)(150 * ratio);  // Augmente de 0 à 150
+        g = (uint8_t)(((uint32_t)(force - orangeZoneStart) * orangeZoneScale) >> 16);  // Augmente de 0 à 150
         b = 0;
     } else {
         // Zone rouge avec intensité décroissante
-        r = (uint8_t)(255 * (force / orangeZoneStart));  // Diminue de 255 à 0
+        r = (uint8_t)(((uint32_t)force * redZoneScale) >> 16);  // Diminue de 255 à 0
         g = 0;
         b = 0;
     }
 
     // Appliquer l'intensité
-    r = (r * brightness) / 255;
-    g = (g * brightness) / 255;
-    b = (b * brightness) / 255;
+    r = (r * (brightness + 1)) >> 8;
+    g = (g * (brightness + 1)) >> 8;
+    b = (b * (brightness + 1)) >> 8;
+
+    rgbToPixel(pixel, r, g, b);
+}
 
-    leds->setPixelColor(index, r, g, b);
-}
\ No newline at end of file
+// Seul le préréglage retenu à la compilation est instancié : les autres ne coûtent rien,
+// sans dépendre de l'élimination du code mort à l'édition de liens (--gc-sections)
+template class TunedFlameMode<FLAME_PRESET>;
\ No newline at end of file
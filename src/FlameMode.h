@@ -2,43 +2,108 @@
 #define FLAME_MODE_H
 
 #include "LightingMode.h"
+#include "FixedMath.h"
+#include "LedConfig.h"
+#include "TimerQueue.h"
 
-class FlameMode : public LightingMode {
+// Réglages de FlameMode, évalués à la compilation : aucun n'occupe de RAM.
+// Un préréglage dérive d'un autre et ne redéfinit que ce qui change.
+struct FlameClassic {
+    // Oscillation de la force globale, en unités de phase (65536 = 2π) par pas de référence
+    static constexpr uint16_t referenceStepTime = 50;        // Pas de temps (ms) des incréments
+    static constexpr uint16_t initialStrengthPhase = 5215;   // 0.5 rad
+    static constexpr uint16_t initialStrengthIncrement = 2608; // 0.25 rad
+    static constexpr uint16_t minStrengthIncrement = 521;    // 0.05 rad
+    static constexpr uint16_t maxStrengthIncrement = 1565;   // 0.15 rad
+    static constexpr uint16_t minStrengthChangeInterval = 1000; // ms
+    static constexpr uint16_t maxStrengthChangeInterval = 3000;
+
+    // Plage de la force globale : le minimum est tiré au hasard, le maximum suit le paramètre global
+    static constexpr float initialForceMin = 0.05;
+    static constexpr float initialForceMax = 2.5;
+    static constexpr float forceMinLow = 0.1;
+    static constexpr float forceMinHigh = 0.5;
+    static constexpr float forceMaxLow = 0.2;                // Paramètre global à 0
+    static constexpr float forceMaxHigh = 2.5;               // Paramètre global à 100
+    static constexpr uint16_t minForceRangeChangeInterval = 2000; // ms
+    static constexpr uint16_t maxForceRangeChangeInterval = 5000;
+
+    // Courbe de force le long de la bande et zones de couleur
+    static constexpr float forceCurveExponent = 1.5;
+    static constexpr float orangeZoneStart = 0.1;
+    static constexpr float orangeZoneEnd = 0.9;
+};
+
+// Bougie : flamme basse et calme, concentrée à la base
+struct FlameCandle : FlameClassic {
+    static constexpr uint16_t minStrengthIncrement = 260;
+    static constexpr uint16_t maxStrengthIncrement = 780;
+    static constexpr float forceMaxLow = 0.2;
+    static constexpr float forceMaxHigh = 1.2;
+    static constexpr float forceCurveExponent = 2.5;
+    static constexpr float orangeZoneEnd = 0.95;
+};
+
+// Feu de camp : flamme haute, agitée, changements fréquents
+struct FlameBonfire : FlameClassic {
+    static constexpr uint16_t minStrengthIncrement = 1043;
+    static constexpr uint16_t maxStrengthIncrement = 2608;
+    static constexpr uint16_t minStrengthChangeInterval = 500;
+    static constexpr uint16_t maxStrengthChangeInterval = 1500;
+    static constexpr float forceMaxHigh = 3.0;
+    static constexpr uint16_t minForceRangeChangeInterval = 1000;
+    static constexpr uint16_t maxForceRangeChangeInterval = 3000;
+};
+
+template <typename Tuning>
+class TunedFlameMode : public LightingMode {
 public:
-    FlameMode(Adafruit_NeoPixel* strip, float* globalParam);
-    void update() override;
+    TunedFlameMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
     void reset() override;
 
 private:
-    // Variables spécifiques au mode flamme
-    float globalStrength;
-    float strengthIncrement;
-    float minStrengthIncrement;
-    float maxStrengthIncrement;
-    unsigned long nextStrengthChange;
-    unsigned long minStrengthChangeInterval;
-    unsigned long maxStrengthChangeInterval;
+    // Constantes dérivées des réglages
+    static constexpr q8_8_t forceCurveExponent = q88FromFloat(Tuning::forceCurveExponent);
+    static constexpr unit16_t orangeZoneStart = unitFromFloat(Tuning::orangeZoneStart);
+    static constexpr unit16_t orangeZoneEnd = unitFromFloat(Tuning::orangeZoneEnd);
+    static constexpr uint32_t redZoneScale = (255UL << 16) / orangeZoneStart;                     // Q16
+    static constexpr uint32_t orangeZoneScale = (150UL << 16) / (orangeZoneEnd - orangeZoneStart); // Q16
+
+    // Changements aléatoires programmés
+    enum FlameTimer : uint8_t {
+        TIMER_STRENGTH,              // Nouvelle vitesse de variation de la force globale
+        TIMER_FORCE_RANGE            // Nouveau minimum de la force globale
+    };
+    TimerPool<2> timers;
+
+    // Oscillation de la force globale
+    uint16_t strengthPhase;          // Accumulateur de phase de la force globale
+    uint16_t strengthIncrement;      // Incrément de phase par pas de référence
 
     // Variables pour le minimum et le maximum de la force globale
     float globalForceMin;
     float globalForceMax;
-    unsigned long nextForceRangeChange;
-    unsigned long minForceRangeChangeInterval;
-    unsigned long maxForceRangeChangeInterval;
+    ParamWatch globalWatch;          // globalForceMax dépend du paramètre global
 
-    // Paramètres pour la courbe de force des LEDs
-    float forceCurveExponent;
-    float orangeZoneStart;
-    float orangeZoneEnd;
+    // Profil spatial précalculé : position^forceCurveExponent pour chaque LED
+    unit16_t forceProfile[LED_COUNT];
+    bool profileValid;               // Profil construit (à la première trame)
 
-    // Variables pour le timing
-    unsigned long previousMillis;
-    unsigned long currentMillis;
-    const long interval = 50;   // Intervalle de mise à jour en millisecondes
+    unsigned long currentMillis;     // Instant de la trame en cours
 
+    void rebuildForceProfile();
     void scheduleNextStrengthChange();
     void scheduleNextForceRangeChange();
-    void setLEDColorFlame(int index, float force);
+    void setLEDColorFlame(uint8_t* pixel, unit16_t force);
 };
 
+// Préréglage de FlameMode choisi à la compilation (-DFLAME_PRESET=FlameCandle ou FlameBonfire),
+// seul instancié dans FlameMode.cpp
+#ifndef FLAME_PRESET
+#define FLAME_PRESET FlameClassic
+#endif
+
+typedef TunedFlameMode<FLAME_PRESET> FlameMode;
+
 #endif // FLAME_MODE_H
\ No newline at end of file
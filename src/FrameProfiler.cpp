@@ -0,0 +1,172 @@
+#include "FrameProfiler.h"
+#include "FrameScheduler.h"
+
+FrameProfiler::FrameProfiler() {
+    lastLoopMicros = 0;
+    loopSleepMicros = 0;
+    frameStartMicros = 0;
+    frameBudgetMicros = 0;
+    frameWorkMicros = 0;
+    lastReportTime = 0;
+    nextChannel = 0;
+    pendingChannels = 0;
+    clear();
+}
+
+void FrameProfiler::clear() {
+    for (uint8_t c = 0; c < PROFILE_CHANNELS; c++) {
+        clearChannel(c);
+    }
+    overruns = 0;
+}
+
+void FrameProfiler::clearChannel(uint8_t channel) {
+    Histogram& h = channels[channel];
+    h.samples = 0;
+    h.minimum = 0xFFFF;
+    h.maximum = 0;
+    for (uint8_t b = 0; b < PROFILER_BUCKETS; b++) {
+        h.buckets[b] = 0;
+    }
+}
+
+void FrameProfiler::record(uint8_t channel, uint32_t elapsed) {
+    Histogram& h = channels[channel];
+    uint16_t value = elapsed > 0xFFFF ? 0xFFFF : (uint16_t)elapsed;
+
+    // Seau = position du bit de poids fort au-delà du premier seau (log2 sans division)
+    uint8_t bucket = 0;
+    uint16_t scaled = value >> PROFILER_BUCKET_SHIFT;
+    while (scaled != 0 && bucket < PROFILER_BUCKETS - 1) {
+        scaled >>= 1;
+        bucket++;
+    }
+
+    // Compteurs saturés plutôt que rebouclés
+    if (h.buckets[bucket] != 0xFFFF) {
+        h.buckets[bucket]++;
+    }
+    if (h.samples != 0xFFFF) {
+        h.samples++;
+    }
+    if (value < h.minimum) {
+        h.minimum = value;
+    }
+    if (value > h.maximum) {
+        h.maximum = value;
+    }
+}
+
+void FrameProfiler::beginFrame(unsigned long frameIntervalMs, unsigned long deadlineMs) {
+    uint32_t now = micros();
+    frameBudgetMicros = frameIntervalMs * 1000UL;
+
+    // Gigue : écart absolu entre le début de la trame et son échéance. Une image fixe attend
+    // sa propre échéance (jusqu'au rafraîchissement) : cette attente n'est pas de la gigue.
+    // Différence modulo 2^32 : micros() et millis() * 1000 rebouclent ensemble.
+    int32_t offset = (int32_t)(now - (uint32_t)deadlineMs * 1000UL);
+    record(PROFILE_JITTER, offset < 0 ? -(uint32_t)offset : (uint32_t)offset);
+    frameStartMicros = now;
+    frameWorkMicros = 0;
+}
+
+void FrameProfiler::recordRender(uint32_t elapsed) {
+    record(PROFILE_RENDER, elapsed);
+    frameWorkMicros += elapsed;
+}
+
+void FrameProfiler::recordShow(uint32_t elapsed) {
+    record(PROFILE_SHOW, elapsed);
+    frameWorkMicros += elapsed;
+}
+
+void FrameProfiler::endFrame() {
+    if (frameWorkMicros > frameBudgetMicros && overruns != 0xFFFF) {
+        overruns++;
+    }
+}
+
+void FrameProfiler::update(const FrameScheduler& scheduler) {
+    uint32_t now = micros();
+    if (lastLoopMicros != 0) {
+        uint32_t elapsed = now - lastLoopMicros;
+        record(PROFILE_LOOP, elapsed > loopSleepMicros ? elapsed - loopSleepMicros : 0);
+    }
+    lastLoopMicros = now;
+    loopSleepMicros = 0;
+
+    // Requête de l'hôte : envoyer tous les canaux dès que le tampon le permet
+    while (Serial.available() > 0) {
+        if (Serial.read() == PROFILER_REQUEST_BYTE) {
+            pendingChannels = (1 << PROFILE_CHANNELS) - 1;
+        }
+    }
+
+    unsigned long currentMillis = millis();
+    if (currentMillis - lastReportTime >= PROFILER_REPORT_INTERVAL) {
+        lastReportTime = currentMillis;
+        pendingChannels |= 1 << nextChannel;
+        nextChannel = (nextChannel + 1) % PROFILE_CHANNELS;
+    }
+
+    // Au plus une trame par tour de boucle, et seulement si elle tient dans le tampon d'émission
+    for (uint8_t c = 0; c < PROFILE_CHANNELS; c++) {
+        if (pendingChannels & (1 << c)) {
+            if (sendChannel(c, scheduler)) {
+                pendingChannels &= ~(1 << c);
+            }
+            break;
+        }
+    }
+}
+
+bool FrameProfiler::sendChannel(uint8_t channel, const FrameScheduler& scheduler) {
+    if (Serial.availableForWrite() < PROFILER_FRAME_SIZE) {
+        return false;
+    }
+
+    uint8_t frame[PROFILER_FRAME_SIZE];
+    uint8_t length = 0;
+    const Histogram& h = channels[channel];
+
+    frame[length++] = PROFILER_SYNC1;
+    frame[length++] = PROFILER_SYNC2;
+    frame[length++] = PROFILER_VERSION;
+    frame[length++] = channel;
+    frame[length++] = PROFILER_PAYLOAD_SIZE;
+
+    uint32_t timestamp = millis();
+    for (uint8_t i = 0; i < 4; i++) {
+        frame[length++] = (uint8_t)(timestamp >> (8 * i));
+    }
+
+    uint16_t fields[7 + PROFILER_BUCKETS];
+    fields[0] = (uint16_t)scheduler.getFrameCount();
+    fields[1] = (uint16_t)scheduler.getLateFrames();
+    fields[2] = (uint16_t)scheduler.getDroppedFrames();
+    fields[3] = overruns;
+    fields[4] = h.samples;
+    fields[5] = h.samples != 0 ? h.minimum : 0;
+    fields[6] = h.maximum;
+    for (uint8_t b = 0; b < PROFILER_BUCKETS; b++) {
+        fields[7 + b] = h.buckets[b];
+    }
+    for (uint8_t i = 0; i < 7 + PROFILER_BUCKETS; i++) {
+        frame[length++] = (uint8_t)fields[i];
+        frame[length++] = (uint8_t)(fields[i] >> 8);
+    }
+
+    // Fletcher-16 à partir de l'octet de version
+    uint8_t sum1 = 0;
+    uint8_t sum2 = 0;
+    for (uint8_t i = 2; i < length; i++) {
+        sum1 = (sum1 + frame[i]) % 255;
+        sum2 = (sum2 + sum1) % 255;
+    }
+    frame[length++] = sum1;
+    frame[length++] = sum2;
+
+    Serial.write(frame, length);
+    clearChannel(channel);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#ifndef FRAME_PROFILER_H
+#define FRAME_PROFILER_H
+
+#include <Arduino.h>
+
+class FrameScheduler;
+
+// Canaux mesurés (durées en microsecondes)
+enum ProfilerChannel {
+    PROFILE_LOOP = 0,     // Durée d'un tour de loop(), veille exclue
+    PROFILE_RENDER,       // Durée de render() du mode actif
+    PROFILE_SHOW,         // Durée de show() (trames effectivement envoyées)
+    PROFILE_JITTER,       // Écart entre le début de la trame et son échéance
+    PROFILE_CHANNELS
+};
+
+#define PROFILER_BUCKETS 12          // Histogramme logarithmique : <16 µs, 16-31 µs, ..., >= 16,4 ms
+#define PROFILER_BUCKET_SHIFT 4      // Largeur du premier seau : 2^4 µs
+#define PROFILER_REPORT_INTERVAL 1000 // Un canal envoyé par seconde, à tour de rôle
+#define PROFILER_REQUEST_BYTE 'T'    // Octet reçu déclenchant l'envoi immédiat des quatre canaux
+
+// Télémétrie binaire (petit-boutiste), une trame par canal :
+//   0xA5 0x5A | version | canal | longueur N | charge utile (N octets) | Fletcher-16 (2 octets)
+// Charge utile : millis (u32), trames, en retard, perdues, dépassements (u16 chacun),
+//   échantillons, min, max (u16, µs), seaux de l'histogramme (PROFILER_BUCKETS × u16).
+// La somme de Fletcher couvre version, canal, longueur et charge utile.
+// Histogramme et min/max d'un canal sont remis à zéro après son envoi.
+#define PROFILER_SYNC1 0xA5
+#define PROFILER_SYNC2 0x5A
+#define PROFILER_VERSION 1
+#define PROFILER_PAYLOAD_SIZE (4 + 4 * 2 + 3 * 2 + PROFILER_BUCKETS * 2)
+#define PROFILER_FRAME_SIZE (5 + PROFILER_PAYLOAD_SIZE + 2)
+
+// Profileur de trames : histogrammes de taille fixe, sans allocation ni texte.
+// Une trame de télémétrie tient dans le tampon d'émission série (64 octets) et n'est
+// écrite que si la place est disponible : l'envoi ne bloque jamais la boucle.
+class FrameProfiler {
+public:
+    FrameProfiler();
+
+    // Appelé à chaque tour de loop() : durée du tour, requêtes et envoi de la télémétrie
+    void update(const FrameScheduler& scheduler);
+
+    // Temps passé en veille pendant le tour de boucle en cours, retiré de sa durée
+    void recordSleep(uint32_t elapsed) { loopSleepMicros += elapsed; }
+
+    // Instrumentation appelée par FrameScheduler. deadlineMs : échéance de la trame (millis),
+    // c'est-à-dire l'instant jusqu'auquel la boucle a pu dormir
+    void beginFrame(unsigned long frameIntervalMs, unsigned long deadlineMs);
+    void recordRender(uint32_t elapsed);
+    void recordShow(uint32_t elapsed);
+    void endFrame();
+
+    void clear();
+
+    uint16_t getOverruns() const { return overruns; }
+
+private:
+    struct Histogram {
+        uint16_t samples;
+        uint16_t minimum;
+        uint16_t maximum;
+        uint16_t buckets[PROFILER_BUCKETS];
+    };
+
+    Histogram channels[PROFILE_CHANNELS];
+
+    uint32_t lastLoopMicros;
+    uint32_t loopSleepMicros;      // Veille du tour de boucle en cours
+    uint32_t frameStartMicros;
+    uint32_t frameBudgetMicros;    // Période cible de la trame en cours
+    uint32_t frameWorkMicros;      // Rendu + envoi de la trame en cours
+    uint16_t overruns;             // Trames dont rendu + envoi dépassent la période cible
+
+    unsigned long lastReportTime;
+    uint8_t nextChannel;           // Prochain canal envoyé périodiquement
+    uint8_t pendingChannels;       // Canaux demandés et pas encore envoyés (un bit par canal)
+
+    void record(uint8_t channel, uint32_t elapsed);
+    void clearChannel(uint8_t channel);
+    bool sendChannel(uint8_t channel, const FrameScheduler& scheduler);
+};
+
+#endif // FRAME_PROFILER_H
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include "FrameScheduler.h"
+#include <string.h>
+
+FrameScheduler::FrameScheduler(Adafruit_NeoPixel* strip, uint8_t targetFps)
+    : leds(strip), frameBuffer(NULL), brightness(255), profiler(NULL), zoneCount(0) {
+    setTargetFps(targetFps);
+    clearStats();
+    lastChecksum = 0;
+    lastSendTime = 0;
+    reset();
+}
+
+void FrameScheduler::setTargetFps(uint8_t fps) {
+    targetFps = max(fps, (uint8_t)1); // Éviter la division par zéro
+    frameInterval = 1000UL / targetFps;
+}
+
+void FrameScheduler::reset() {
+    unsigned long now = millis();
+    lastFrameTime = now;
+    nextFrameTime = now; // La première trame est produite immédiatement
+    forceNextFrame = true;
+
+    // Les zones repartent toutes de maintenant
+    for (uint8_t z = 0; z < zoneCount; z++) {
+        zones[z].nextTime = now;
+        zones[z].lastTime = now;
+    }
+}
+
+int8_t FrameScheduler::addZone(LightingMode* mode, uint8_t fps) {
+    if (zoneCount >= MAX_ZONES) {
+        return -1;
+    }
+    Zone& zone = zones[zoneCount];
+    zone.mode = mode;
+    // Une zone ne peut pas être rendue plus souvent que les trames
+    zone.interval = max(1000UL / max(fps, (uint8_t)1), frameInterval);
+    zone.nextTime = millis();
+    zone.lastTime = zone.nextTime;
+    return zoneCount++;
+}
+
+void FrameScheduler::setZoneMode(uint8_t zone, LightingMode* mode) {
+    if (zone < zoneCount) {
+        zones[zone].mode = mode;
+    }
+}
+
+void FrameScheduler::clearStats() {
+    frameCount = 0;
+    lateFrames = 0;
+    droppedFrames = 0;
+    framesSent = 0;
+    framesSkipped = 0;
+}
+
+unsigned long FrameScheduler::wakeTime(const LightingMode* mode, bool continuous) const {
+    unsigned long delay = mode->renderDelay();
+    if (forceNextFrame || continuous || delay == 0) {
+        return nextFrameTime;
+    }
+
+    // Mode au repos : son échéance, au plus tard le rafraîchissement, jamais avant le créneau suivant
+    unsigned long deadline = lastFrameTime + min(delay, refreshInterval);
+    return (long)(deadline - nextFrameTime) > 0 ? deadline : nextFrameTime;
+}
+
+bool FrameScheduler::update(LightingMode* mode) {
+    unsigned long now = millis();
+    unsigned long wake = wakeTime(mode);
+    if ((long)(now - wake) < 0) {
+        return false;
+    }
+    // Au repos, le créneau suit l'échéance du mode : l'attente n'est pas un retard
+    nextFrameTime = wake;
+    if (!startFrame(now)) {
+        return false;
+    }
+
+    unsigned long dt = now - lastFrameTime;
+    lastFrameTime = now;
+
+    // Rendu de la trame puis envoi unique
+    uint32_t renderStart = micros();
+    renderMode(mode, now, dt);
+    finishFrame(now, renderStart);
+
+    return true;
+}
+
+bool FrameScheduler::update() {
+    unsigned long now = millis();
+    if (!startFrame(now)) {
+        return false;
+    }
+    lastFrameTime = now;
+
+    // Rendu des zones arrivées à échéance, chacune avec son propre dt
+    uint32_t renderStart = micros();
+    for (uint8_t z = 0; z < zoneCount; z++) {
+        Zone& zone = zones[z];
+        if ((long)(now - zone.nextTime) < 0 || zone.mode == NULL) {
+            continue;
+        }
+        zone.nextTime += zone.interval;
+        if ((long)(now - zone.nextTime) >= 0) {
+            zone.nextTime = now + zone.interval; // Retard d'une période ou plus : recalage
+        }
+        renderMode(zone.mode, now, now - zone.lastTime);
+        zone.lastTime = now;
+    }
+    finishFrame(now, renderStart);
+
+    return true;
+}
+
+bool FrameScheduler::startFrame(unsigned long now) {
+    // Comparaison signée pour rester correct au débordement de millis()
+    if ((long)(now - nextFrameTime) < 0) {
+        return false;
+    }
+
+    unsigned long deadline = nextFrameTime;
+    unsigned long lateness = now - nextFrameTime;
+    if (lateness >= frameInterval) {
+        // Un ou plusieurs créneaux ont été manqués : on se recale sur l'instant présent
+        droppedFrames += lateness / frameInterval;
+        lateFrames++;
+        nextFrameTime = now + frameInterval;
+    } else {
+        if (lateness > lateTolerance) {
+            lateFrames++;
+        }
+        nextFrameTime += frameInterval;
+    }
+
+    if (profiler != NULL) {
+        profiler->beginFrame(frameInterval, deadline);
+    }
+    return true;
+}
+
+void FrameScheduler::renderMode(LightingMode* mode, unsigned long now, unsigned long dt) {
+    if (frameBuffer != NULL) {
+        mode->renderInto(frameBuffer, now, dt);
+    } else {
+        mode->render(now, dt);
+    }
+}
+
+void FrameScheduler::finishFrame(unsigned long now, uint32_t renderStart) {
+    // La recopie et la luminosité font partie du coût de production de la trame
+    if (frameBuffer != NULL) {
+        copyFrameToStrip();
+    }
+    if (profiler != NULL) {
+        profiler->recordRender(micros() - renderStart);
+    }
+    frameCount++;
+    pushFrame(now);
+    if (profiler != NULL) {
+        profiler->endFrame();
+    }
+}
+
+void FrameScheduler::pushFrame(unsigned long now) {
+    uint32_t checksum = frameChecksum();
+
+    // Trame identique à la précédente : inutile de bloquer les interruptions pour la renvoyer
+    if (!forceNextFrame && checksum == lastChecksum && now - lastSendTime < refreshInterval) {
+        framesSkipped++;
+        return;
+    }
+
+    if (profiler != NULL) {
+        uint32_t showStart = micros();
+        leds->show();
+        profiler->recordShow(micros() - showStart);
+    } else {
+        leds->show();
+    }
+    lastChecksum = checksum;
+    lastSendTime = now;
+    forceNextFrame = false;
+    framesSent++;
+}
+
+uint32_t FrameScheduler::frameChecksum() const {
+    // Somme de Fletcher (modulo 2^16) : sensible à la position des octets, quelques cycles par octet
+    const uint8_t* pixels = leds->getPixels();
+    uint16_t count = leds->numPixels() * LED_BYTES_PER_PIXEL;
+    uint16_t sum1 = 0;
+    uint16_t sum2 = 0;
+
+    for (uint16_t i = 0; i < count; i++) {
+        sum1 += pixels[i];
+        sum2 += sum1;
+    }
+
+    return ((uint32_t)sum2 << 16) | sum1;
+}
+
+void FrameScheduler::copyFrameToStrip() {
+    uint8_t* pixels = leds->getPixels();
+    uint16_t count = LED_COUNT * LED_BYTES_PER_PIXEL;
+
+    if (brightness == 255) {
+        memcpy(pixels, frameBuffer, count);
+        return;
+    }
+
+    // Même échelle que Adafruit_NeoPixel::setBrightness()
+    uint16_t scale = brightness + 1;
+    for (uint16_t i = 0; i < count; i++) {
+        pixels[i] = (frameBuffer[i] * scale) >> 8;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+#ifndef FRAME_SCHEDULER_H
+#define FRAME_SCHEDULER_H
+
+#include <Adafruit_NeoPixel.h>
+#include "LightingMode.h"
+#include "LedConfig.h"
+#include "FrameProfiler.h"
+
+#define MAX_ZONES 4   // Zones (segments de la bande) animées par update() sans argument
+
+// Ordonnanceur de trames à cadence fixe.
+// Appelle render() du mode actif une fois par trame puis envoie la trame (show) une seule fois.
+// Une trame identique à la dernière envoyée n'est pas retransmise (sauf rafraîchissement périodique).
+//
+// Plusieurs modes peuvent se partager la bande, chacun sur son segment : ils sont déclarés comme
+// zones, chacune avec sa propre cadence (au plus celle de l'ordonnanceur). À chaque trame, seules
+// les zones arrivées à échéance sont rendues, puis la bande entière part en un seul show().
+class FrameScheduler {
+public:
+    FrameScheduler(Adafruit_NeoPixel* strip, uint8_t targetFps);
+
+    // Produit une trame si son échéance est atteinte. Retourne true si une trame a été produite.
+    // Un mode statique (renderDelay()) n'est rendu qu'à sa propre échéance, au plus tard au
+    // rafraîchissement périodique.
+    bool update(LightingMode* mode);
+
+    // Instant (millis) de la prochaine trame que update(mode) produira : la boucle peut dormir jusque-là.
+    // continuous : une entrée du mode évolue hors de lui à chaque tour de boucle (paramètre en cours
+    // d'ajustement) ; le créneau de trame suivant est alors retenu même si le mode est au repos.
+    unsigned long wakeTime(const LightingMode* mode, bool continuous = false) const;
+
+    // Idem pour les zones déclarées par addZone()
+    bool update();
+
+    // Déclare une zone rendue à fps trames par seconde. Retourne son numéro, ou -1 si MAX_ZONES est atteint.
+    int8_t addZone(LightingMode* mode, uint8_t fps);
+    // Remplace le mode d'une zone (par exemple après ModeRegistry::activate())
+    void setZoneMode(uint8_t zone, LightingMode* mode);
+    void clearZones() { zoneCount = 0; }
+
+    // Resynchronise l'horloge des trames (par exemple après un changement de mode)
+    void reset();
+
+    void setTargetFps(uint8_t fps);
+    uint8_t getTargetFps() const { return targetFps; }
+
+    // Statistiques
+    unsigned long getFrameCount() const { return frameCount; }
+    unsigned long getLateFrames() const { return lateFrames; }
+    unsigned long getDroppedFrames() const { return droppedFrames; }
+    unsigned long getFramesSent() const { return framesSent; }
+    unsigned long getFramesSkipped() const { return framesSkipped; }
+    void clearStats();
+
+    // Force l'envoi de la prochaine trame même si elle est inchangée
+    void invalidate() { forceNextFrame = true; }
+
+    // Tampon hors écran optionnel (LED_COUNT pixels au format de la bande, NULL : rendu direct dans la bande).
+    // Avec un tampon, la trame est recopiée vers la bande au moment de l'envoi, luminosité appliquée.
+    void setFrameBuffer(uint8_t* buffer) { frameBuffer = buffer; forceNextFrame = true; }
+
+    // Luminosité globale (255 : pleine), appliquée une fois par trame lors de la recopie.
+    // Sans tampon hors écran les modes écrivent directement les valeurs envoyées : non appliquée.
+    void setBrightness(uint8_t level) { brightness = level; forceNextFrame = true; }
+    uint8_t getBrightness() const { return brightness; }
+
+    // Profileur optionnel recevant les durées de rendu et d'envoi (NULL : pas de mesure)
+    void setProfiler(FrameProfiler* frameProfiler) { profiler = frameProfiler; }
+
+private:
+    Adafruit_NeoPixel* leds;
+    uint8_t* frameBuffer;
+    uint8_t brightness;
+    FrameProfiler* profiler;
+    uint8_t targetFps;
+    unsigned long frameInterval;   // Durée d'une trame en millisecondes
+    unsigned long nextFrameTime;   // Échéance de la prochaine trame
+    unsigned long lastFrameTime;   // Instant de la dernière trame produite
+
+    unsigned long frameCount;      // Trames produites
+    unsigned long lateFrames;      // Trames démarrées en retard
+    unsigned long droppedFrames;   // Créneaux de trame entièrement manqués
+    unsigned long framesSent;      // Trames transmises à la bande
+    unsigned long framesSkipped;   // Trames identiques non transmises
+
+    // Détection des trames inchangées
+    uint32_t lastChecksum;         // Somme de contrôle de la dernière trame envoyée
+    unsigned long lastSendTime;    // Instant du dernier envoi effectif
+    bool forceNextFrame;
+
+    const unsigned long lateTolerance = 2;       // millis() peut avancer de 2 ms d'un coup
+    const unsigned long refreshInterval = 1000;  // Renvoi forcé (ms) pour corriger d'éventuels parasites
+
+    struct Zone {
+        LightingMode* mode;
+        unsigned long interval;    // Période de rendu de la zone (ms)
+        unsigned long nextTime;    // Échéance du prochain rendu
+        unsigned long lastTime;    // Instant du dernier rendu (dt passé au mode)
+    };
+    Zone zones[MAX_ZONES];
+    uint8_t zoneCount;
+
+    uint32_t frameChecksum() const;
+    bool startFrame(unsigned long now);
+    void finishFrame(unsigned long now, uint32_t renderStart);
+    void renderMode(LightingMode* mode, unsigned long now, unsigned long dt);
+    void copyFrameToStrip();
+    void pushFrame(unsigned long now);
+};
+
+#endif // FRAME_SCHEDULER_H
\ No newline at end of file
@@ -1,87 +1,86 @@
 #include "GradientMode.h"
 #include "Utils.h"
-#include <math.h>
+#include "LookupTables.h"
+#include "ColorKernel.h"
+#include "Logger.h"
 #include <Arduino.h>
 
-GradientMode::GradientMode(Adafruit_NeoPixel* strip, float* globalParam)
-    : LightingMode(strip, globalParam) {
-    // Initialisation des variables
+template <typename Tuning>
+TunedGradientMode<Tuning>::TunedGradientMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment)
+    : LightingMode(strip, parameterBank, ledSegment), globalWatch(PARAM_GLOBAL) {
+    // Initialisation des variables (réglages : voir GradientClassic)
 
     // Mouvement de la LED maître
-    movementRangePercentage = 0.8; // La LED maître se déplace sur 80% des LEDs
-    movementRangeStart = (int)((1.0 - movementRangePercentage) / 2.0 * leds->numPixels());
-    movementRangeEnd = leds->numPixels() - movementRangeStart - 1;
+    movementRangeStart = (int)((1.0 - Tuning::movementRangePercentage) / 2.0 * segment.length);
+    movementRangeEnd = segment.length - movementRangeStart - 1;
     masterLedIndex = movementRangeStart;
     masterLedDirection = 1; // Commence en avançant
     lastMoveTime = millis();
-    moveInterval = 50; // Intervalle par défaut de 500 ms entre les mouvements
+    moveInterval = 50; // Recalculé à la première trame
 
     // Intensité
-    masterLedIntensityMin = 0.5; // Intensité minimale de la LED maître
-    masterLedIntensityMax = 1.0; // Intensité maximale de la LED maître
-    masterLedIntensity = masterLedIntensityMax; // Initialisation
-    minIntensityLow = 0.001; // Intensité minimale basse
-    minIntensityHigh = 0.01; // Intensité minimale haute
-    minIntensity = minIntensityLow; // Initialisation
-    intensityCurveExponent = 2.0; // Exposant pour la courbe de décroissance
+    masterLedIntensity = unitFromFloat(Tuning::masterLedIntensityMax); // Initialisation
+    minIntensity = unitFromFloat(Tuning::minIntensityLow); // Initialisation
+    intensityCurveExponent = q88FromFloat(Tuning::curveExponentLow); // Exposant pour la courbe de décroissance
 
     // Gradient de couleur dynamique
     hueCenter = 0;        // Rouge (0 degrés)
-    hueSpread = 0.2;      // Fraction de la plage de teinte totale
-
-    // Paramètres dynamiques pour le spread de teinte
-    hueSpreadMin = 0.1;   // Largeur minimale du spread de teinte (fraction)
-    hueSpreadMax = 0.3;   // Largeur maximale du spread de teinte (fraction)
-    hueSpreadSpeed = 0.001; // Vitesse d'évolution de la largeur du spread (cycles par seconde)
-    hueCenterMin = 0;     // Teinte minimale du centre du spread (0-65535)
-    hueCenterMax = 65535; // Teinte maximale du centre du spread (0-65535)
-    hueCenterSpeed = 0.001; // Vitesse d'évolution du centre du spread (cycles par seconde)
+    hueSpread = unitFromFloat(Tuning::initialHueSpread);
 
     // Variables de phase pour le spread de teinte
-    hueSpreadPhase = 0.0;
-    hueCenterPhase = 0.0;
+    hueSpreadPhase = 0;
+    hueCenterPhase = 0;
 
     // Variables pour l'influence du globalParameter
-    saturationLow = 200;
-    saturationHigh = 255;
-    saturation = saturationHigh; // Initialisation
+    saturation = Tuning::saturationHigh; // Initialisation
+
+    // Profil de valeurs construit à la première trame
+    profileValid = false;
+    profileMaxDistance = 1;
+    profileExponent = 0;
+    profileMasterIntensity = 0;
+    profileMinIntensity = 0;
+
+    // Aucune trame rendue
+    renderedValid = false;
+    renderedData = NULL;
+    renderedLength = 0;
+    skippedFrames = 0;
 }
 
-void GradientMode::update() {
-    unsigned long currentTime = millis();
+template <typename Tuning>
+void TunedGradientMode<Tuning>::renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) {
+    unsigned long currentTime = now;
 
-    // Calcul du temps écoulé depuis la dernière mise à jour
+    // Calcul du temps écoulé depuis le dernier mouvement de la LED maître
     unsigned long elapsedTime = currentTime - lastMoveTime;
 
-    // Mise à jour des phases pour le spread de teinte
-    float deltaTimeSeconds = (float)elapsedTime / 1000.0;
-    hueSpreadPhase += hueSpreadSpeed * deltaTimeSeconds * TWO_PI; // Convert cycles/s to radians
-    if (hueSpreadPhase > TWO_PI) {
-        hueSpreadPhase -= TWO_PI;
-    }
-
-    hueCenterPhase += hueCenterSpeed * deltaTimeSeconds * TWO_PI;
-    if (hueCenterPhase > TWO_PI) {
-        hueCenterPhase -= TWO_PI;
-    }
+    // Mise à jour des phases pour le spread de teinte (avance de la durée de la trame)
+    // Les accumulateurs 32 bits rebouclent naturellement sur un cycle
+    hueSpreadPhase += hueSpreadPhaseStep * dt;
+    hueCenterPhase += hueCenterPhaseStep * dt;
 
-    // Calculer les valeurs actuelles de spread et de center
-    float currentHueSpreadFraction = hueSpreadMin + (hueSpreadMax - hueSpreadMin) * (sin(hueSpreadPhase) + 1.0) / 2.0;
-    float currentHueCenter = hueCenterMin + (float)(hueCenterMax - hueCenterMin) * (sin(hueCenterPhase) + 1.0) / 2.0;
+    // Calculer les valeurs actuelles de spread et de center (16 bits de poids fort = phase)
+    unit16_t spreadSin = lutSinUnit(hueSpreadPhase >> 16);
+    unit16_t centerSin = lutSinUnit(hueCenterPhase >> 16);
 
     // Mise à jour du spread
-    hueSpread = currentHueSpreadFraction; // Fraction de la plage de teinte totale (0.0 - 1.0)
-    hueCenter = (uint16_t)currentHueCenter; // Teinte centrale actuelle
+    hueSpread = hueSpreadMin + (unit16_t)(((uint32_t)(hueSpreadMax - hueSpreadMin) * spreadSin) >> 16); // Fraction de la plage de teinte totale
+    hueCenter = Tuning::hueCenterMin + (uint16_t)(((uint32_t)(Tuning::hueCenterMax - Tuning::hueCenterMin) * centerSin) >> 16); // Teinte centrale actuelle
 
-    // Mise à jour des paramètres en fonction du globalParameter
-    // Ajuster moveInterval et intensityCurveExponent
-    moveInterval = mapf(*globalParameter, 0.0, 100.0, 1000.0, 100.0); // De 1000 ms à 100 ms
-    intensityCurveExponent = mapf(*globalParameter, 0.0, 100.0, 2.0, 4.0); // De 2.0 à 4.0
+    // Mise à jour des paramètres en fonction du globalParameter, seulement s'il a changé
+    if (globalWatch.changed(*parameters)) {
+        float globalParameter = parameters->get(PARAM_GLOBAL);
 
-    // Influence du globalParameter sur les intensités et la saturation
-    masterLedIntensity = mapf(*globalParameter, 0.0, 100.0, masterLedIntensityMin, masterLedIntensityMax);
-    minIntensity = mapf(*globalParameter, 0.0, 100.0, minIntensityLow, minIntensityHigh);
-    saturation = (uint8_t)mapf(*globalParameter, 0.0, 100.0, saturationLow, saturationHigh);
+        // Ajuster moveInterval et intensityCurveExponent
+        moveInterval = mapf(globalParameter, 0.0, 100.0, Tuning::moveIntervalLow, Tuning::moveIntervalHigh);
+        intensityCurveExponent = q88FromFloat(mapf(globalParameter, 0.0, 100.0, Tuning::curveExponentLow, Tuning::curveExponentHigh));
+
+        // Influence du globalParameter sur les intensités et la saturation
+        masterLedIntensity = unitFromFloat(mapf(globalParameter, 0.0, 100.0, Tuning::masterLedIntensityMin, Tuning::masterLedIntensityMax));
+        minIntensity = unitFromFloat(mapf(globalParameter, 0.0, 100.0, Tuning::minIntensityLow, Tuning::minIntensityHigh));
+        saturation = (uint8_t)mapf(globalParameter, 0.0, 100.0, Tuning::saturationLow, Tuning::saturationHigh);
+    }
 
     // Mise à jour du mouvement de la LED maître
     if (elapsedTime >= moveInterval) {
@@ -101,76 +100,113 @@ void GradientMode::update() {
         lastMoveTime = currentTime;
     }
 
-    // Mise à jour des LEDs
-    for (int i = 0; i < leds->numPixels(); i++) {
-        // Calculer l'intensité en fonction de la distance à la LED maître
-        float intensity = calculateIntensity(i);
-
-        // Calculer la couleur en fonction de la distance et de l'intensité
-        uint32_t color = calculateColor(i, intensity);
+    // Valeurs par distance : reconstruites seulement si la portée, l'exposant (quantifié)
+    // ou les intensités dérivées de globalParameter changent
+    bool profileChanged = updateValueProfile();
+
+    // Entrées de teinte quantifiées sur 8 bits : les dérives lentes (0.001 cycle/s) ne changent
+    // la trame que toutes les secondes environ
+    uint8_t hueCenterKey = hueCenter >> 8;
+    uint8_t hueSpreadKey = hueSpread >> 8;
+
+    if (renderedValid && outputRetained && !profileChanged &&
+        hueCenterKey == renderedHueCenter && hueSpreadKey == renderedHueSpread &&
+        saturation == renderedSaturation && masterLedIndex == renderedMasterIndex &&
+        span.data == renderedData && span.length == renderedLength) {
+        // Pixels identiques à la trame précédente, déjà dans span
+        skippedFrames++;
+        LOG_EVERY(LOG_LEVEL_DEBUG, 10000, "Dégradé : trames sautées ", (long)skippedFrames);
+        return;
+    }
 
-        leds->setPixelColor(i, color);
+    renderedValid = true;
+    renderedHueCenter = hueCenterKey;
+    renderedHueSpread = hueSpreadKey;
+    renderedSaturation = saturation;
+    renderedMasterIndex = masterLedIndex;
+    renderedData = span.data;
+    renderedLength = span.length;
+
+    // Plage de teinte de la trame
+    // Le spread est une fraction de la plage de teinte totale, donc directement en unités de teinte
+    uint16_t halfVariation = ((uint16_t)hueSpreadKey << 8) / 2;
+    uint16_t hueCenterQuantized = (uint16_t)hueCenterKey << 8;
+    uint16_t hueStartLocal = hueCenterQuantized - halfVariation; // Reboucle modulo 65536
+    uint16_t hueEndLocal = hueCenterQuantized + halfVariation;
+    uint16_t hueRange;
+    if (hueEndLocal >= hueStartLocal) {
+        hueRange = hueEndLocal - hueStartLocal;
+    } else {
+        // Si hueEndLocal < hueStartLocal, cela signifie qu'il y a un wrap autour de 65535
+        hueRange = 65535 - hueStartLocal + hueEndLocal;
     }
+    uint32_t hueStep = ((uint32_t)hueRange << 16) / profileMaxDistance; // Incrément de teinte par LED de distance (Q16)
+
+    // Mise à jour des LEDs : deux rampes partant de la LED maître, vers la fin puis vers le début du segment
+    // (sens physique inversé pour un segment inversé)
+    uint16_t master = masterLedIndex;
 
-    leds->show();
+    hsvRampSpan(span.at(master), span.length - master, span.direction(),
+                hueStartLocal, hueStep, saturation, valueProfile);
+    if (master > 0) {
+        hsvRampSpan(span.at(master - 1), master, -span.direction(),
+                    hueStartLocal + (uint16_t)(hueStep >> 16), hueStep, saturation, valueProfile + 1);
+    }
 }
 
-void GradientMode::reset() {
+template <typename Tuning>
+void TunedGradientMode<Tuning>::reset() {
     // Réinitialiser les variables si nécessaire
-    movementRangeStart = (int)((1.0 - movementRangePercentage) / 2.0 * leds->numPixels());
-    movementRangeEnd = leds->numPixels() - movementRangeStart - 1;
+    movementRangeStart = (int)((1.0 - Tuning::movementRangePercentage) / 2.0 * segment.length);
+    movementRangeEnd = segment.length - movementRangeStart - 1;
     masterLedIndex = movementRangeStart;
     masterLedDirection = 1;
     lastMoveTime = millis();
 
     // Réinitialiser les phases
-    hueSpreadPhase = 0.0;
-    hueCenterPhase = 0.0;
-}
-
-float GradientMode::calculateIntensity(int ledIndex) {
-    int distance = abs(ledIndex - masterLedIndex);
-    int maxDistance = max(abs(movementRangeEnd - movementRangeStart), 1); // Éviter la division par zéro
-    float normalizedDistance = (float)distance / (float)maxDistance;
-
-    // Calculer l'intensité en utilisant l'exposant de courbe
-    float intensity = masterLedIntensity * pow(1.0 - normalizedDistance, intensityCurveExponent);
-    intensity = max(intensity, minIntensity);
+    hueSpreadPhase = 0;
+    hueCenterPhase = 0;
 
-    // Limiter l'intensité entre minIntensity et masterLedIntensity
-    intensity = constrain(intensity, minIntensity, masterLedIntensity);
-
-    return intensity;
+    // La prochaine trame est rendue entièrement
+    renderedValid = false;
+    skippedFrames = 0;
 }
 
-uint32_t GradientMode::calculateColor(int ledIndex, float intensity) {
-    int distance = abs(ledIndex - masterLedIndex);
-    int maxDistance = max(abs(movementRangeEnd - movementRangeStart), 1);
+template <typename Tuning>
+bool TunedGradientMode<Tuning>::updateValueProfile() {
+    int maxDistance = max(abs(movementRangeEnd - movementRangeStart), 1); // Éviter la division par zéro
+    q8_8_t exponent = (intensityCurveExponent + exponentQuantum / 2) & ~(exponentQuantum - 1);
 
-    // Calculer la fraction de distance
-    float t = (float)distance / (float)maxDistance;
+    if (profileValid && maxDistance == profileMaxDistance &&
+        exponent == profileExponent && masterLedIntensity == profileMasterIntensity &&
+        minIntensity == profileMinIntensity) {
+        return false;
+    }
 
-    // Calculer la teinte en fonction de la distance et du spread
-    float hueVariation = hueSpread * 65535.0; // Convertir la fraction de spread en unités de teinte
-    uint16_t hueStartLocal = (uint16_t)(hueCenter - (hueVariation / 2.0));
-    uint16_t hueEndLocal = (uint16_t)(hueCenter + (hueVariation / 2.0));
+    profileValid = true;
+    profileMaxDistance = maxDistance;
+    profileExponent = exponent;
+    profileMasterIntensity = masterLedIntensity;
+    profileMinIntensity = minIntensity;
+
+    for (uint16_t d = 0; d < segment.length; d++) {
+        // Calculer l'intensité en fonction de la distance à la LED maître :
+        // masterLedIntensity * (1 - d / maxDistance)^exposant, nulle au-delà de la portée du mouvement
+        unit16_t curve = 0;
+        if ((int)d <= maxDistance) {
+            unit16_t normalizedDistance = ((uint32_t)d * UNIT_ONE) / maxDistance;
+            curve = lutPowUnit(UNIT_ONE - normalizedDistance, exponent);
+        }
+        unit16_t intensity = unitMul(masterLedIntensity, curve);
 
-    // Assurer que hueStart et hueEnd sont dans [0, 65535] en utilisant modulo
-    hueStartLocal = hueStartLocal % 65536;
-    hueEndLocal = hueEndLocal % 65536;
+        // Limiter l'intensité entre minIntensity et masterLedIntensity
+        intensity = constrain(intensity, minIntensity, masterLedIntensity);
 
-    // Calculer la teinte interpolée
-    uint16_t hue;
-    if (hueEndLocal >= hueStartLocal) {
-        hue = hueStartLocal + (uint16_t)(t * (hueEndLocal - hueStartLocal));
-    } else {
-        // Si hueEndLocal < hueStartLocal, cela signifie qu'il y a un wrap autour de 65535
-        hue = (hueStartLocal + (uint16_t)(t * (65535 - hueStartLocal + hueEndLocal))) % 65536;
+        // Ajuster la valeur (brightness) en fonction de l'intensité
+        valueProfile[d] = unitTo8(intensity);
     }
+    return true;
+}
 
-    // Ajuster la valeur (brightness) en fonction de l'intensité
-    uint8_t adjustedValue = (uint8_t)(255.0 * intensity);
-
-    // Retourner la couleur
-    return leds->ColorHSV(hue, saturation, adjustedValue);
-}
\ No newline at end of file
+// Seul le préréglage retenu à la compilation est instancié
+template class TunedGradientMode<GRADIENT_PRESET>;
\ No newline at end of file
@@ -2,14 +2,58 @@
 #define GRADIENT_MODE_H
 
 #include "LightingMode.h"
+#include "FixedMath.h"
+#include "LedConfig.h"
 
-class GradientMode : public LightingMode {
+// Réglages de GradientMode, évalués à la compilation : aucun n'occupe de RAM.
+// Les couples Low/High sont les valeurs pour un paramètre global de 0 et de 100.
+struct GradientClassic {
+    // Mouvement de la LED maître
+    static constexpr float movementRangePercentage = 0.8;    // La LED maître se déplace sur 80% des LEDs
+    static constexpr float moveIntervalLow = 1000.0;         // Intervalle entre les mouvements (ms)
+    static constexpr float moveIntervalHigh = 100.0;
+
+    // Intensité
+    static constexpr float masterLedIntensityMin = 0.5;      // Intensité de la LED maître
+    static constexpr float masterLedIntensityMax = 1.0;
+    static constexpr float minIntensityLow = 0.001;          // Intensité des LEDs les plus éloignées
+    static constexpr float minIntensityHigh = 0.01;
+    static constexpr float curveExponentLow = 2.0;           // Exposant de la courbe de décroissance
+    static constexpr float curveExponentHigh = 4.0;
+
+    // Gradient de couleur dynamique
+    static constexpr float initialHueSpread = 0.2;           // Fraction de la plage de teinte totale
+    static constexpr float hueSpreadMin = 0.1;               // Largeur du spread de teinte (fraction)
+    static constexpr float hueSpreadMax = 0.3;
+    static constexpr float hueSpreadSpeed = 0.001;           // Cycles par seconde
+    static constexpr uint16_t hueCenterMin = 0;              // Centre du spread (0-65535)
+    static constexpr uint16_t hueCenterMax = 65535;
+    static constexpr float hueCenterSpeed = 0.001;           // Cycles par seconde
+
+    // Saturation
+    static constexpr float saturationLow = 200;
+    static constexpr float saturationHigh = 255;
+};
+
+template <typename Tuning>
+class TunedGradientMode : public LightingMode {
 public:
-    GradientMode(Adafruit_NeoPixel* strip, float* globalParam);
-    void update() override;
+    TunedGradientMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
     void reset() override;
 
+    // Trames sautées par le rendu différentiel depuis le dernier reset()
+    uint32_t getSkippedFrames() const { return skippedFrames; }
+
 private:
+    // Constantes dérivées des réglages
+    static constexpr unit16_t hueSpreadMin = unitFromFloat(Tuning::hueSpreadMin);
+    static constexpr unit16_t hueSpreadMax = unitFromFloat(Tuning::hueSpreadMax);
+    // Incréments de phase par milliseconde (un cycle = 2^32)
+    static constexpr uint32_t hueSpreadPhaseStep = (uint32_t)(Tuning::hueSpreadSpeed * 4294967.296);
+    static constexpr uint32_t hueCenterPhaseStep = (uint32_t)(Tuning::hueCenterSpeed * 4294967.296);
+    static constexpr q8_8_t exponentQuantum = 16; // Pas de quantification de l'exposant (1/16)
+
     // Variables pour le mouvement de la LED maître
     int masterLedIndex;                  // Index actuel de la LED maître
     int masterLedDirection;              // Direction du mouvement : 1 pour avant, -1 pour arrière
@@ -17,41 +61,52 @@ private:
     unsigned long moveInterval;          // Intervalle entre les mouvements (en millisecondes)
     int movementRangeStart;              // Index de début du mouvement de la LED maître
     int movementRangeEnd;                // Index de fin du mouvement de la LED maître
-    float movementRangePercentage;       // Pourcentage du nombre total de LEDs pour le mouvement
 
-    // Variables pour l'intensité
-    float masterLedIntensity;            // Intensité de la LED maître (calculée dynamiquement)
-    float masterLedIntensityMin;         // Intensité minimale de la LED maître
-    float masterLedIntensityMax;         // Intensité maximale de la LED maître
-    float minIntensity;                  // Intensité minimale des LEDs les plus éloignées (calculée dynamiquement)
-    float minIntensityLow;               // Intensité minimale basse
-    float minIntensityHigh;              // Intensité minimale haute
-    float intensityCurveExponent;        // Exposant pour la courbe de décroissance de l'intensité (influencé par globalParameter)
+    // Variables pour l'intensité (calculées dynamiquement)
+    unit16_t masterLedIntensity;         // Intensité de la LED maître
+    unit16_t minIntensity;               // Intensité minimale des LEDs les plus éloignées
+    q8_8_t intensityCurveExponent;       // Exposant pour la courbe de décroissance de l'intensité (influencé par globalParameter)
 
     // Variables pour le gradient de couleur dynamique
     uint16_t hueCenter;                  // Teinte centrale du spread (0-65535)
-    float hueSpread;                     // Largeur du spread de teinte (0.0-1.0, fraction de la plage de teinte totale)
-
-    // Paramètres dynamiques pour le spread de teinte
-    float hueSpreadMin;                  // Largeur minimale du spread de teinte
-    float hueSpreadMax;                  // Largeur maximale du spread de teinte
-    float hueSpreadSpeed;                // Vitesse d'évolution de la largeur du spread (cycles par seconde)
-    uint16_t hueCenterMin;               // Teinte minimale du centre du spread (0-65535)
-    uint16_t hueCenterMax;               // Teinte maximale du centre du spread (0-65535)
-    float hueCenterSpeed;                // Vitesse d'évolution du centre du spread (cycles par seconde)
+    unit16_t hueSpread;                  // Largeur du spread de teinte (fraction de la plage de teinte totale)
 
-    // Variables de phase pour le spread de teinte
-    float hueSpreadPhase;                // Phase actuelle pour la largeur du spread
-    float hueCenterPhase;                // Phase actuelle pour le centre du spread
+    // Variables de phase pour le spread de teinte (accumulateurs 32 bits, un cycle = 2^32)
+    uint32_t hueSpreadPhase;             // Phase actuelle pour la largeur du spread
+    uint32_t hueCenterPhase;             // Phase actuelle pour le centre du spread
 
     // Variables pour l'influence du globalParameter
-    float saturationLow;                 // Saturation basse
-    float saturationHigh;                // Saturation haute
     uint8_t saturation;                  // Saturation actuelle (calculée dynamiquement)
+    ParamWatch globalWatch;              // Les valeurs ci-dessus ne sont recalculées que s'il change
+
+    // Valeurs (brightness) précalculées, indexées par la distance à la LED maître
+    uint8_t valueProfile[LED_COUNT];     // Une entrée par distance possible (0..LED_COUNT-1)
+    bool profileValid;                   // Profil construit au moins une fois
+    int profileMaxDistance;              // Portée du mouvement utilisée pour le profil
+    q8_8_t profileExponent;              // Exposant quantifié utilisé pour le profil
+    unit16_t profileMasterIntensity;     // Intensités utilisées pour le profil
+    unit16_t profileMinIntensity;
 
-    // Fonctions pour calculer l'intensité et la couleur
-    float calculateIntensity(int ledIndex);
-    uint32_t calculateColor(int ledIndex, float intensity);
+    // Rendu différentiel : entrées quantifiées de la dernière trame rendue. Les pixels n'en
+    // dépendent que par elles ; tant qu'aucune ne change, la trame précédente est conservée.
+    bool renderedValid;                  // Une trame a été rendue avec les entrées ci-dessous
+    uint8_t renderedHueCenter;           // 8 bits de poids fort de hueCenter
+    uint8_t renderedHueSpread;           // 8 bits de poids fort de hueSpread
+    uint8_t renderedSaturation;
+    int renderedMasterIndex;
+    uint8_t* renderedData;               // Portée écrite (un changement de cible impose un rendu)
+    uint16_t renderedLength;
+    uint32_t skippedFrames;              // Trames identiques non recalculées
+
+    // Reconstruit le profil de valeurs si l'une de ses entrées a changé (retourne vrai dans ce cas)
+    bool updateValueProfile();
 };
 
+// Préréglage de GradientMode choisi à la compilation (-DGRADIENT_PRESET=...)
+#ifndef GRADIENT_PRESET
+#define GRADIENT_PRESET GradientClassic
+#endif
+
+typedef TunedGradientMode<GRADIENT_PRESET> GradientMode;
+
 #endif // GRADIENT_MODE_H
\ No newline at end of file
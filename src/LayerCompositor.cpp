@@ -0,0 +1,66 @@
+#include "LayerCompositor.h"
+
+LayerCompositor::LayerCompositor(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment)
+    : LightingMode(strip, parameterBank, ledSegment), base(NULL), layerCount(0) {}
+
+void LayerCompositor::renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) {
+    // Couche de base : écrit tous les pixels
+    if (base != NULL) {
+        base->renderSpan(span, now, dt);
+    } else {
+        span.clear();
+    }
+
+    // Couches superposées, de bas en haut ; une couche invisible évolue quand même
+    for (uint8_t i = 0; i < layerCount; i++) {
+        layers[i].layer->composite(span, layers[i].op, layers[i].opacity, now, dt);
+    }
+}
+
+void LayerCompositor::reset() {
+    if (base != NULL) {
+        base->reset();
+    }
+    for (uint8_t i = 0; i < layerCount; i++) {
+        layers[i].layer->reset();
+    }
+}
+
+void LayerCompositor::setBase(LightingMode* mode) {
+    base = mode;
+    if (base != NULL) {
+        base->setOutputRetained(false);
+    }
+}
+
+int8_t LayerCompositor::addLayer(OverlayLayer* layer, BlendOp op, uint8_t opacity) {
+    if (layerCount >= MAX_LAYERS) {
+        return -1;
+    }
+    layers[layerCount].layer = layer;
+    layers[layerCount].op = op;
+    layers[layerCount].opacity = opacity;
+    return layerCount++;
+}
+
+void LayerCompositor::setOpacity(uint8_t index, uint8_t opacity) {
+    if (index < layerCount) {
+        layers[index].opacity = opacity;
+    }
+}
+
+void LayerCompositor::setBlendOp(uint8_t index, BlendOp op) {
+    if (index < layerCount) {
+        layers[index].op = op;
+    }
+}
+
+void ModeLayer::composite(const PixelSpan& span, BlendOp op, uint8_t opacity,
+                          unsigned long now, unsigned long dt) {
+    // Portée hors écran de même orientation que span : les octets se correspondent un à un
+    uint16_t last = span.length > 0 ? span.length - 1 : 0;
+    PixelSpan offscreen(span.stride > 0 ? scratch : scratch + last * LED_BYTES_PER_PIXEL, span.length, span.stride);
+    mode->renderSpan(offscreen, now, dt);
+
+    blendSpan(span.lowest(), scratch, span.length * LED_BYTES_PER_PIXEL, op, opacity);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#ifndef LAYER_COMPOSITOR_H
+#define LAYER_COMPOSITOR_H
+
+#include "LightingMode.h"
+#include "OverlayLayer.h"
+
+#define MAX_LAYERS 3   // Couches superposées au mode de base
+
+// Mode composite : un mode de base rendu directement dans la trame, puis jusqu'à MAX_LAYERS
+// couches fusionnées par-dessus, chacune avec son opération et son opacité.
+//
+//   EnvelopePool<8> starPool;
+//   StarOverlay stars(starPool);
+//   LayerCompositor layered(&leds, &parameters);
+//   layered.setBase(&gradient);
+//   layered.addLayer(&stars, BLEND_SCREEN, 200);
+class LayerCompositor : public LightingMode {
+public:
+    LayerCompositor(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
+    void reset() override;
+
+    // Les couches écrivent par-dessus la base : celle-ci ne peut pas sauter de trame
+    void setBase(LightingMode* mode);
+
+    // Ajoute une couche au sommet de la pile. Retourne son numéro, ou -1 si la pile est pleine.
+    int8_t addLayer(OverlayLayer* layer, BlendOp op, uint8_t opacity = 255);
+    void setOpacity(uint8_t index, uint8_t opacity);
+    void setBlendOp(uint8_t index, BlendOp op);
+
+private:
+    struct Layer {
+        OverlayLayer* layer;
+        BlendOp op;
+        uint8_t opacity;
+    };
+
+    LightingMode* base;
+    Layer layers[MAX_LAYERS];
+    uint8_t layerCount;
+};
+
+// Couche dense : un mode complet rendu hors écran puis fusionné sur toute la portée.
+// scratch doit contenir au moins autant de pixels que les portées fusionnées (format de la bande).
+class ModeLayer : public OverlayLayer {
+public:
+    ModeLayer(LightingMode* mode, uint8_t* scratch) : mode(mode), scratch(scratch) {}
+    void composite(const PixelSpan& span, BlendOp op, uint8_t opacity,
+                   unsigned long now, unsigned long dt) override;
+    void reset() override { mode->reset(); }
+
+private:
+    LightingMode* mode;
+    uint8_t* scratch;
+};
+
+#endif // LAYER_COMPOSITOR_H
\ No newline at end of file
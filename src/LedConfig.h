@@ -0,0 +1,64 @@
+#ifndef LED_CONFIG_H
+#define LED_CONFIG_H
+
+#include <Adafruit_NeoPixel.h>
+
+// Nombre de LEDs de la bande : source unique pour la bande, les modes et le budget RAM.
+// Fixé à la compilation (-DLED_COUNT=... dans build_flags pour une autre bande).
+#ifndef LED_COUNT
+#define LED_COUNT 10
+#endif
+
+static_assert(LED_COUNT >= 2 && LED_COUNT <= 1000, "LED_COUNT hors limites (2 à 1000)");
+
+// Type de la bande : ordre des couleurs et fréquence du signal
+#define LED_TYPE   (NEO_GRB + NEO_KHZ800)
+
+// Position de chaque composante dans un pixel (même encodage que Adafruit_NeoPixel)
+const uint8_t LED_OFFSET_W = (LED_TYPE >> 6) & 0x03;
+const uint8_t LED_OFFSET_R = (LED_TYPE >> 4) & 0x03;
+const uint8_t LED_OFFSET_G = (LED_TYPE >> 2) & 0x03;
+const uint8_t LED_OFFSET_B = LED_TYPE & 0x03;
+
+// Octets par pixel dans le tampon de la bande (W confondu avec R : bande RGB)
+const uint8_t LED_BYTES_PER_PIXEL = (LED_OFFSET_W == LED_OFFSET_R) ? 3 : 4;
+
+// Budget RAM : tampon de la bande, mode actif et autres globales du croquis (comptés par sizeof
+// là où ils sont définis), plus une réserve pour ce que sizeof ne voit pas. Réserve sur Uno :
+//   - Serial (cœur Arduino) : tampons de réception et d'émission, 64 + 64, et ~29 octets d'état ;
+//   - cœur : compteurs de millis()/micros(), état de malloc, ~16 octets ;
+//   - chaînes du journal : en RAM sur AVR (pas de PROGMEM), 209 octets aux niveaux INFO et WARN
+//     (248 avec les préfixes de Logger.cpp),
+//     aucune avec LOG_LEVEL=0 (env:uno_release) ;
+//   - pile : chaîne la plus profonde loop() → FrameScheduler::update() → renderSpan() →
+//     StarOverlay::composite() → spawn(), 376 octets mesurés par -fstack-usage sur l'hôte
+//     (adresses et registres de 8 octets), environ la moitié sur AVR, plus les registres sauvés
+//     par une interruption (Timer0 ou INT0) : 256 octets.
+#ifndef SERIAL_RX_BUFFER_SIZE
+#define SERIAL_RX_BUFFER_SIZE 64
+#endif
+#ifndef SERIAL_TX_BUFFER_SIZE
+#define SERIAL_TX_BUFFER_SIZE 64
+#endif
+#define RAM_SERIAL_BYTES (SERIAL_RX_BUFFER_SIZE + SERIAL_TX_BUFFER_SIZE + 29)
+#define RAM_CORE_BYTES 16
+#if defined(LOG_LEVEL) && LOG_LEVEL == 0
+#define RAM_LOG_STRING_BYTES 0
+#else
+#define RAM_LOG_STRING_BYTES 248
+#endif
+#define RAM_STACK_BYTES 256
+#define RAM_RESERVE_BYTES (RAM_SERIAL_BYTES + RAM_CORE_BYTES + RAM_LOG_STRING_BYTES + RAM_STACK_BYTES)
+#ifndef RAM_SIZE_BYTES
+#ifdef __AVR__
+#define RAM_SIZE_BYTES (RAMEND - RAMSTART + 1)
+#else
+// Hôte : pas de contrainte. -DRAM_SIZE_BYTES=2048 donne une vérification pessimiste du budget
+// d'un Uno : pointeurs et unsigned long y font 8 octets, les globales sont environ deux fois plus grosses.
+#define RAM_SIZE_BYTES 65536UL
+#endif
+#endif
+#define LED_RAM_FITS(modeStorage, globals) \
+    ((unsigned long)LED_COUNT * LED_BYTES_PER_PIXEL + (modeStorage) + (globals) + RAM_RESERVE_BYTES <= RAM_SIZE_BYTES)
+
+#endif // LED_CONFIG_H
\ No newline at end of file
@@ -0,0 +1,32 @@
+#ifndef LED_SEGMENT_H
+#define LED_SEGMENT_H
+
+#include <Arduino.h>
+#include "LedConfig.h"
+
+// Portion de la bande confiée à un mode : offset du premier pixel, nombre de pixels et sens.
+// L'index logique 0 d'un segment inversé (direction -1) est son dernier pixel physique.
+// Par défaut, la bande entière dans son sens.
+struct LedSegment {
+    uint16_t offset;
+    uint16_t length;
+    int8_t direction;    // 1 : sens de la bande, -1 : inversé
+
+    LedSegment(uint16_t first = 0, uint16_t count = LED_COUNT, int8_t dir = 1)
+        : offset(first), length(count), direction(dir < 0 ? -1 : 1) {
+        // Rester dans la bande
+        if (offset > LED_COUNT) {
+            offset = LED_COUNT;
+        }
+        if (length > LED_COUNT - offset) {
+            length = LED_COUNT - offset;
+        }
+    }
+
+    // Index physique du pixel logique i (i < length)
+    uint16_t physical(uint16_t i) const {
+        return direction > 0 ? offset + i : offset + length - 1 - i;
+    }
+};
+
+#endif // LED_SEGMENT_H
\ No newline at end of file
@@ -2,18 +2,56 @@
 #define LIGHTING_MODE_H
 
 #include <Adafruit_NeoPixel.h>
+#include "FastRandom.h"
+#include "LedConfig.h"
+#include "LedSegment.h"
+#include "PixelSpan.h"
+#include "ParameterBank.h"
+
+#define RENDER_NEVER 0xFFFFFFFFUL   // renderDelay() d'un mode statique
 
 class LightingMode {
 public:
-    LightingMode(Adafruit_NeoPixel* strip, float* globalParam) 
-        : leds(strip), globalParameter(globalParam) {}
+    LightingMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment, uint32_t randomSeed = 1) 
+        : leds(strip), parameters(parameterBank), segment(ledSegment), rng(randomSeed), outputRetained(true) {}
+    virtual ~LightingMode() {}
     
-    virtual void update() = 0;
+    // Point d'entrée de rendu, appelé une fois par trame.
+    // span : pixels du segment du mode dans le tampon cible, écrits directement (ordre LED_TYPE).
+    // now : instant de la trame (millis), dt : temps écoulé depuis la trame précédente (ms).
+    // Le mode réécrit tous les pixels de span, sauf s'il sait qu'ils n'ont pas changé depuis la
+    // trame précédente et que span les conserve (voir setOutputRetained) ; l'envoi (show) et la
+    // luminosité globale sont appliqués par le FrameScheduler.
+    virtual void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) = 0;
+
+    // Rendu dans un tampon hors écran de LED_COUNT pixels au format de la bande
+    void renderInto(uint8_t* frame, unsigned long now, unsigned long dt) { renderSpan(PixelSpan(frame, segment), now, dt); }
+
+    // Rendu directement dans le tampon de la bande, sans copie
+    void render(unsigned long now, unsigned long dt) { renderInto(leds->getPixels(), now, dt); }
+
     virtual void reset() = 0;
 
+    // Délai (ms) après la dernière trame rendue avant que le mode n'ait à nouveau besoin d'être
+    // rendu. 0 : mode animé, rendu à chaque trame (défaut). RENDER_NEVER : image fixe jusqu'à un
+    // changement de paramètre ; le FrameScheduler ne le rend plus qu'au rafraîchissement périodique
+    // et la boucle peut dormir entre-temps.
+    virtual unsigned long renderDelay() const { return 0; }
+
+    // Réensemence le flux pseudo-aléatoire du mode (rejeu reproductible d'une animation)
+    void seedRandom(uint32_t seed) { rng.seed(seed); }
+
+    // Indique si span conserve d'une trame à l'autre les pixels écrits par le mode (vrai par défaut).
+    // Faux quand un autre rendu écrit par-dessus (couche de base d'un LayerCompositor) : le mode
+    // doit alors tout réécrire à chaque trame.
+    void setOutputRetained(bool retained) { outputRetained = retained; }
+
 protected:
     Adafruit_NeoPixel* leds;
-    float* globalParameter;
+    ParameterBank* parameters;   // Paramètres utilisateur (voir ParamWatch pour les valeurs dérivées)
+    LedSegment segment;     // Pixels confiés au mode (indices logiques 0..segment.length-1)
+    FastRandom rng;
+    bool outputRetained;    // Voir setOutputRetained()
 };
 
 #endif // LIGHTING_MODE_H
\ No newline at end of file
@@ -0,0 +1,110 @@
+#include "Logger.h"
+#include <string.h>
+
+// Journal global
+Logger logger;
+
+// Réserve pour le texte numérique, le séparateur et la fin de ligne
+static const uint8_t valueReserve = 16;
+// Place maximale signalée par availableForWrite() (tampon de 64 octets)
+static const uint8_t txBufferSpace = 63;
+
+Logger::Logger() {
+    head = 0;
+    tail = 0;
+    written = 0;
+    dropped = 0;
+    reportedDropped = 0;
+    rateLimited = 0;
+    drainMicros = 0;
+}
+
+Logger::Entry* Logger::reserve() {
+    uint8_t next = (head + 1) % LOG_QUEUE_SIZE;
+    if (next == tail) {
+        dropped++;
+        return NULL;
+    }
+    return &queue[head];
+}
+
+void Logger::push(uint8_t level, const char* message) {
+    Entry* entry = reserve();
+    if (entry == NULL) {
+        return;
+    }
+    entry->message = message;
+    entry->level = level;
+    entry->type = VALUE_NONE;
+    head = (head + 1) % LOG_QUEUE_SIZE;
+}
+
+void Logger::push(uint8_t level, const char* message, long value) {
+    Entry* entry = reserve();
+    if (entry == NULL) {
+        return;
+    }
+    entry->message = message;
+    entry->level = level;
+    entry->type = VALUE_LONG;
+    entry->value.asLong = value;
+    head = (head + 1) % LOG_QUEUE_SIZE;
+}
+
+void Logger::push(uint8_t level, const char* message, float value) {
+    Entry* entry = reserve();
+    if (entry == NULL) {
+        return;
+    }
+    entry->message = message;
+    entry->level = level;
+    entry->type = VALUE_FLOAT;
+    entry->value.asFloat = value;
+    head = (head + 1) % LOG_QUEUE_SIZE;
+}
+
+void Logger::drain() {
+    if (head == tail && reportedDropped == dropped) {
+        return;
+    }
+    uint32_t start = micros();
+
+    // Signaler d'abord les messages perdus depuis le dernier signalement
+    if (reportedDropped != dropped && Serial.availableForWrite() >= (int)valueReserve + 16) {
+        Serial.print("[log] perdus : ");
+        Serial.println(dropped - reportedDropped);
+        reportedDropped = dropped;
+    }
+
+    while (head != tail) {
+        const Entry& entry = queue[tail];
+
+        // Ne jamais attendre le port série : la ligne doit tenir dans le tampon d'émission
+        size_t length = strlen(entry.message) + (entry.type == VALUE_NONE ? 2 : valueReserve) +
+                        (entry.level <= LOG_LEVEL_WARN ? 12 : 0);
+        if (length > txBufferSpace) {
+            length = txBufferSpace;
+        }
+        if (Serial.availableForWrite() < (int)length) {
+            break;
+        }
+
+        if (entry.level == LOG_LEVEL_ERROR) {
+            Serial.print("[erreur] ");
+        } else if (entry.level == LOG_LEVEL_WARN) {
+            Serial.print("[attention] ");
+        }
+        Serial.print(entry.message);
+        if (entry.type == VALUE_LONG) {
+            Serial.print(entry.value.asLong);
+        } else if (entry.type == VALUE_FLOAT) {
+            Serial.print(entry.value.asFloat);
+        }
+        Serial.println();
+
+        tail = (tail + 1) % LOG_QUEUE_SIZE;
+        written++;
+    }
+
+    drainMicros += micros() - start;
+}
\ No newline at end of file
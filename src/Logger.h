@@ -0,0 +1,128 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <Arduino.h>
+
+// Niveaux de journalisation
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+// Niveau retenu à la compilation (-DLOG_LEVEL=... dans build_flags).
+// Les messages de niveau supérieur disparaissent du binaire, chaînes comprises.
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_QUEUE_SIZE 8   // Messages en attente d'envoi (8 octets chacun sur AVR)
+
+// Journal non bloquant : les appels ne font qu'enregistrer un pointeur vers le message
+// et une valeur dans une file circulaire préallouée. Le formatage et l'écriture sur le
+// port série ont lieu dans drain(), entre deux trames, et seulement si le tampon
+// d'émission peut absorber la ligne. File pleine : le message est compté comme perdu.
+class Logger {
+public:
+    Logger();
+
+    // Les messages doivent être des chaînes constantes (seul le pointeur est conservé)
+    void push(uint8_t level, const char* message);
+    void push(uint8_t level, const char* message, long value);
+    void push(uint8_t level, const char* message, int value) { push(level, message, (long)value); }
+    void push(uint8_t level, const char* message, float value);
+    void push(uint8_t level, const char* message, double value) { push(level, message, (float)value); }
+
+    // Écrit les messages en attente tant que le tampon d'émission le permet
+    void drain();
+
+    // Messages en attente d'écriture
+    bool pending() const { return head != tail; }
+
+    // Statistiques
+    unsigned long getWritten() const { return written; }
+    unsigned long getDropped() const { return dropped; }
+    unsigned long getRateLimited() const { return rateLimited; }
+    unsigned long getDrainMicros() const { return drainMicros; }  // Temps cumulé passé dans drain()
+
+    void countRateLimited() { rateLimited++; }
+
+private:
+    enum ValueType : uint8_t {
+        VALUE_NONE,
+        VALUE_LONG,
+        VALUE_FLOAT
+    };
+
+    struct Entry {
+        const char* message;
+        uint8_t level;
+        uint8_t type;
+        union {
+            long asLong;
+            float asFloat;
+        } value;
+    };
+
+    Entry queue[LOG_QUEUE_SIZE];
+    volatile uint8_t head;     // Prochaine écriture
+    volatile uint8_t tail;     // Prochaine lecture
+    unsigned long written;
+    unsigned long dropped;
+    unsigned long reportedDropped;  // Pertes déjà signalées sur le port série
+    unsigned long rateLimited;
+    unsigned long drainMicros;
+
+    Entry* reserve();
+};
+
+// Limiteur par site d'appel : au plus un message par intervalle.
+// Agrégat sans constructeur, initialisé à zéro en mémoire statique.
+struct LogRateLimit {
+    unsigned long lastTime;
+    bool started;
+
+    bool allow(unsigned long interval) {
+        unsigned long now = millis();
+        if (started && now - lastTime < interval) {
+            return false;
+        }
+        started = true;
+        lastTime = now;
+        return true;
+    }
+};
+
+extern Logger logger;
+
+#if LOG_LEVEL > LOG_LEVEL_NONE
+
+// LOG(niveau, message [, valeur]) : enregistre le message si le niveau est compilé
+#define LOG(level, ...) \
+    do { \
+        if ((level) <= LOG_LEVEL) { \
+            logger.push((level), __VA_ARGS__); \
+        } \
+    } while (0)
+
+// LOG_EVERY(niveau, intervalle ms, message [, valeur]) : idem, limité par site d'appel
+#define LOG_EVERY(level, interval, ...) \
+    do { \
+        if ((level) <= LOG_LEVEL) { \
+            static LogRateLimit logRateLimit; \
+            if (logRateLimit.allow(interval)) { \
+                logger.push((level), __VA_ARGS__); \
+            } else { \
+                logger.countRateLimited(); \
+            } \
+        } \
+    } while (0)
+
+#else
+
+#define LOG(level, ...) do { } while (0)
+#define LOG_EVERY(level, interval, ...) do { } while (0)
+
+#endif
+
+#endif // LOGGER_H
\ No newline at end of file
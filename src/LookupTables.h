@@ -0,0 +1,75 @@
+#ifndef LOOKUP_TABLES_H
+#define LOOKUP_TABLES_H
+
+#include <Arduino.h>
+#include "FixedMath.h"
+
+// Tables de courbes en mémoire flash (PROGMEM), aucune SRAM utilisée.
+// Les données sont générées par tools/generate_lookup_tables.py dans LookupTablesData.cpp :
+// toute modification des constantes ci-dessous doit y être reportée.
+
+const uint16_t LUT_SINE_SIZE = 256;      // Une période complète
+const uint8_t LUT_POW_POINTS = 65;       // 64 segments par courbe
+const uint8_t LUT_POW_K_COUNT = 11;      // k = 1.5, 1.75, ... 4.0
+const q8_8_t LUT_POW_K_MIN = 384;        // 1.5 en Q8.8
+const q8_8_t LUT_POW_K_MAX = 1024;       // 4.0 en Q8.8
+const uint8_t LUT_POW_K_SHIFT = 6;       // Pas de k : 0.25 = 64 en Q8.8
+
+extern const int16_t lutSineTable[LUT_SINE_SIZE] PROGMEM;
+extern const uint16_t lutPowTable[LUT_POW_K_COUNT][LUT_POW_POINTS] PROGMEM;
+extern const uint8_t lutGammaTable[256] PROGMEM;
+extern const uint8_t lutFireTable[256][3] PROGMEM;
+
+// Sinus interpolé sur un accumulateur de phase (65536 = 2π), résultat en Q1.15
+inline int16_t lutSin16(uint16_t phase) {
+    uint8_t index = phase >> 8;
+    int16_t a = (int16_t)pgm_read_word(&lutSineTable[index]);
+    int16_t b = (int16_t)pgm_read_word(&lutSineTable[(uint8_t)(index + 1)]);
+    return (int16_t)(a + ((((int32_t)b - a) * (phase & 0xFF)) >> 8));
+}
+
+// (sin + 1) / 2 dans [0, 1]
+inline unit16_t lutSinUnit(uint16_t phase) {
+    return (unit16_t)((int32_t)lutSin16(phase) + 32768);
+}
+
+// x^k pour l'exposant tabulé d'indice curve, interpolé en x
+inline unit16_t lutPowCurve(uint8_t curve, unit16_t x) {
+    uint8_t index = x >> 10;
+    uint16_t a = pgm_read_word(&lutPowTable[curve][index]);
+    uint16_t b = pgm_read_word(&lutPowTable[curve][index + 1]);
+    return (unit16_t)(a + ((((int32_t)b - a) * (x & 0x3FF)) >> 10));
+}
+
+// x^k interpolé en x et entre les deux exposants tabulés voisins de k.
+// Hors de [1.5, 4.0], repli sur le calcul powUnit() de FixedMath.
+inline unit16_t lutPowUnit(unit16_t x, q8_8_t k) {
+    if (k < LUT_POW_K_MIN || k > LUT_POW_K_MAX) {
+        return powUnit(x, k);
+    }
+
+    uint16_t offset = k - LUT_POW_K_MIN;
+    uint8_t curve = offset >> LUT_POW_K_SHIFT;
+    uint8_t fraction = offset & ((1 << LUT_POW_K_SHIFT) - 1);
+
+    unit16_t a = lutPowCurve(curve, x);
+    if (fraction == 0) {
+        return a;
+    }
+    unit16_t b = lutPowCurve(curve + 1, x);
+    return (unit16_t)(a + ((((int32_t)b - a) * fraction) >> LUT_POW_K_SHIFT));
+}
+
+// Correction gamma 8 bits
+inline uint8_t lutGamma8(uint8_t x) {
+    return pgm_read_byte(&lutGammaTable[x]);
+}
+
+// Couleur de flamme (palette de FireMode) pour une chaleur 0-255
+inline void lutFire(uint8_t heat, uint8_t& r, uint8_t& g, uint8_t& b) {
+    r = pgm_read_byte(&lutFireTable[heat][0]);
+    g = pgm_read_byte(&lutFireTable[heat][1]);
+    b = pgm_read_byte(&lutFireTable[heat][2]);
+}
+
+#endif // LOOKUP_TABLES_H
\ No newline at end of file
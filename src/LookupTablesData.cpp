@@ -0,0 +1,252 @@
+// Fichier généré par tools/generate_lookup_tables.py : ne pas modifier à la main
+#include "LookupTables.h"
+
+// sin(2π * i / 256) en Q1.15
+const int16_t lutSineTable[LUT_SINE_SIZE] PROGMEM = {
+    0, 804, 1608, 2410, 3212, 4011, 4808, 5602,
+    6393, 7179, 7962, 8739, 9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767, 32757, 32728, 32678, 32609, 32521, 32412, 32285,
+    32137, 31971, 31785, 31580, 31356, 31113, 30852, 30571,
+    30273, 29956, 29621, 29268, 28898, 28510, 28105, 27683,
+    27245, 26790, 26319, 25832, 25329, 24811, 24279, 23731,
+    23170, 22594, 22005, 21403, 20787, 20159, 19519, 18868,
+    18204, 17530, 16846, 16151, 15446, 14732, 14010, 13279,
+    12539, 11793, 11039, 10278, 9512, 8739, 7962, 7179,
+    6393, 5602, 4808, 4011, 3212, 2410, 1608, 804,
+    0, -804, -1608, -2410, -3212, -4011, -4808, -5602,
+    -6393, -7179, -7962, -8739, -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530,
+    -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790,
+    -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971,
+    -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285,
+    -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683,
+    -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868,
+    -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278, -9512, -8739, -7962, -7179,
+    -6393, -5602, -4808, -4011, -3212, -2410, -1608, -804,
+};
+
+// (j / 64)^k en fraction 16 bits, une ligne par exposant k = 1.50 + 0.25 * ligne
+const uint16_t lutPowTable[LUT_POW_K_COUNT][LUT_POW_POINTS] PROGMEM = {
+    // k = 1.50
+    {
+        0, 128, 362, 665, 1024, 1431, 1881, 2371, 2896,
+        3456, 4048, 4670, 5321, 6000, 6705, 7436, 8192, 8972,
+        9775, 10601, 11448, 12318, 13208, 14119, 15049, 16000, 16969,
+        17958, 18964, 19989, 21032, 22093, 23170, 24265, 25376, 26504,
+        27648, 28808, 29983, 31175, 32381, 33603, 34840, 36092, 37358,
+        38639, 39934, 41243, 42566, 43903, 45254, 46619, 47996, 49388,
+        50792, 52209, 53640, 55083, 56539, 58007, 59488, 60981, 62487,
+        64005, 65535,
+    },
+    // k = 1.75
+    {
+        0, 45, 152, 309, 512, 757, 1041, 1363, 1722,
+        2116, 2545, 3007, 3501, 4028, 4585, 5174, 5793, 6441,
+        7118, 7825, 8560, 9323, 10113, 10932, 11777, 12649, 13548,
+        14473, 15424, 16400, 17403, 18431, 19484, 20562, 21664, 22792,
+        23944, 25120, 26320, 27544, 28791, 30063, 31358, 32676, 34017,
+        35382, 36769, 38179, 39612, 41068, 42546, 44046, 45568, 47113,
+        48680, 50268, 51878, 53511, 55164, 56839, 58536, 60254, 61993,
+        63754, 65535,
+    },
+    // k = 2.00
+    {
+        0, 16, 64, 144, 256, 400, 576, 784, 1024,
+        1296, 1600, 1936, 2304, 2704, 3136, 3600, 4096, 4624,
+        5184, 5776, 6400, 7056, 7744, 8464, 9216, 10000, 10816,
+        11664, 12544, 13456, 14400, 15376, 16384, 17424, 18496, 19600,
+        20736, 21904, 23104, 24336, 25600, 26896, 28224, 29584, 30976,
+        32400, 33855, 35343, 36863, 38415, 39999, 41615, 43263, 44943,
+        46655, 48399, 50175, 51983, 53823, 55695, 57599, 59535, 61503,
+        63503, 65535,
+    },
+    // k = 2.25
+    {
+        0, 6, 27, 67, 128, 211, 319, 451, 609,
+        794, 1006, 1247, 1516, 1815, 2145, 2505, 2896, 3320,
+        3775, 4263, 4785, 5340, 5930, 6553, 7212, 7906, 8635,
+        9400, 10202, 11040, 11915, 12827, 13777, 14765, 15791, 16855,
+        17958, 19100, 20281, 21501, 22762, 24062, 25403, 26784, 28206,
+        29669, 31173, 32718, 34305, 35934, 37605, 39319, 41075, 42874,
+        44715, 46600, 48528, 50499, 52515, 54574, 56677, 58825, 61017,
+        63254, 65535,
+    },
+    // k = 2.50
+    {
+        0, 2, 11, 31, 64, 112, 176, 259, 362,
+        486, 632, 803, 998, 1219, 1467, 1743, 2048, 2383,
+        2749, 3147, 3578, 4042, 4540, 5074, 5644, 6250, 6894,
+        7576, 8297, 9058, 9859, 10701, 11585, 12511, 13481, 14494,
+        15552, 16654, 17803, 18997, 20238, 21527, 22864, 24249, 25684,
+        27168, 28702, 30288, 31925, 33613, 35355, 37149, 38997, 40899,
+        42856, 44867, 46935, 49058, 51238, 53475, 55770, 58123, 60534,
+        63005, 65535,
+    },
+    // k = 2.75
+    {
+        0, 1, 5, 15, 32, 59, 98, 149, 215,
+        298, 398, 517, 656, 818, 1003, 1213, 1448, 1711,
+        2002, 2323, 2675, 3059, 3476, 3929, 4416, 4941, 5504,
+        6106, 6748, 7431, 8158, 8927, 9742, 10602, 11509, 12464,
+        13468, 14522, 15627, 16784, 17995, 19259, 20579, 21954, 23387,
+        24878, 26428, 28038, 29709, 31443, 33239, 35099, 37024, 39015,
+        41073, 43199, 45394, 47658, 49993, 52399, 54877, 57430, 60056,
+        62757, 65535,
+    },
+    // k = 3.00
+    {
+        0, 0, 2, 7, 16, 31, 54, 86, 128,
+        182, 250, 333, 432, 549, 686, 844, 1024, 1228,
+        1458, 1715, 2000, 2315, 2662, 3042, 3456, 3906, 4394,
+        4921, 5488, 6097, 6750, 7448, 8192, 8984, 9826, 10719,
+        11664, 12663, 13718, 14830, 16000, 17230, 18522, 19876, 21296,
+        22781, 24334, 25955, 27648, 29412, 31250, 33162, 35151, 37219,
+        39365, 41593, 43903, 46298, 48777, 51344, 53999, 56744, 59581,
+        62511, 65535,
+    },
+    // k = 3.25
+    {
+        0, 0, 1, 3, 8, 17, 30, 49, 76,
+        112, 157, 214, 284, 369, 469, 587, 724, 882,
+        1062, 1266, 1495, 1752, 2038, 2355, 2704, 3088, 3508,
+        3966, 4463, 5002, 5585, 6213, 6889, 7613, 8389, 9217,
+        10101, 11042, 12042, 13102, 14226, 15415, 16670, 17995, 19391,
+        20861, 22405, 24027, 25729, 27512, 29379, 31332, 33373, 35505,
+        37728, 40047, 42462, 44976, 47591, 50310, 53135, 56067, 59110,
+        62265, 65535,
+    },
+    // k = 3.50
+    {
+        0, 0, 0, 1, 4, 9, 17, 28, 45,
+        68, 99, 138, 187, 248, 321, 408, 512, 633,
+        773, 934, 1118, 1326, 1561, 1823, 2116, 2441, 2801,
+        3196, 3630, 4104, 4621, 5183, 5793, 6451, 7162, 7927,
+        8748, 9628, 10570, 11576, 12649, 13791, 15004, 16292, 17657,
+        19102, 20630, 22243, 23944, 25735, 27621, 29603, 31685, 33870,
+        36159, 38558, 41068, 43692, 46435, 49298, 52284, 55398, 58643,
+        62021, 65535,
+    },
+    // k = 3.75
+    {
+        0, 0, 0, 1, 2, 5, 9, 16, 27,
+        42, 62, 89, 123, 166, 219, 284, 362, 454,
+        563, 690, 836, 1004, 1195, 1412, 1656, 1930, 2236,
+        2576, 2952, 3367, 3824, 4324, 4871, 5467, 6114, 6816,
+        7576, 8396, 9279, 10228, 11247, 12338, 13505, 14750, 16079,
+        17492, 18995, 20590, 22282, 24073, 25968, 27970, 30082, 32310,
+        34656, 37124, 39719, 42445, 45306, 48305, 51448, 54738, 58179,
+        61777, 65535,
+    },
+    // k = 4.00
+    {
+        0, 0, 0, 0, 1, 2, 5, 9, 16,
+        26, 39, 57, 81, 112, 150, 198, 256, 326,
+        410, 509, 625, 760, 915, 1093, 1296, 1526, 1785,
+        2076, 2401, 2763, 3164, 3607, 4096, 4632, 5220, 5862,
+        6561, 7321, 8145, 9037, 10000, 11038, 12155, 13354, 14641,
+        16018, 17490, 19061, 20736, 22518, 24414, 26426, 28561, 30822,
+        33215, 35744, 38415, 41234, 44204, 47333, 50624, 54084, 57719,
+        61534, 65535,
+    },
+};
+
+// Correction gamma 2.6 sur 8 bits
+const uint8_t lutGammaTable[256] PROGMEM = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3,
+    3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 6, 6, 7,
+    7, 7, 8, 8, 8, 9, 9, 9, 10, 10, 10, 11, 11, 11, 12, 12,
+    13, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 19, 19, 20,
+    20, 21, 21, 22, 22, 23, 24, 24, 25, 25, 26, 27, 27, 28, 29, 29,
+    30, 31, 31, 32, 33, 34, 34, 35, 36, 37, 38, 38, 39, 40, 41, 42,
+    42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+    58, 59, 60, 61, 62, 63, 64, 65, 66, 68, 69, 70, 71, 72, 73, 75,
+    76, 77, 78, 80, 81, 82, 84, 85, 86, 88, 89, 90, 92, 93, 94, 96,
+    97, 99, 100, 102, 103, 105, 106, 108, 109, 111, 112, 114, 115, 117, 119, 120,
+    122, 124, 125, 127, 129, 130, 132, 134, 136, 137, 139, 141, 143, 145, 146, 148,
+    150, 152, 154, 156, 158, 160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180,
+    182, 184, 186, 188, 191, 193, 195, 197, 199, 202, 204, 206, 209, 211, 213, 215,
+    218, 220, 223, 225, 227, 230, 232, 235, 237, 240, 242, 245, 247, 250, 252, 255,
+};
+
+// Palette de FireMode : couleurs de FlameMode (zones rouge, orange et blanche à 0.10 et 0.90)
+// pour chaque chaleur, en {r, g, b}
+const uint8_t lutFireTable[256][3] PROGMEM = {
+    {0, 0, 0}, {0, 0, 0}, {0, 0, 0}, {0, 0, 0},
+    {0, 0, 0}, {1, 0, 0}, {1, 0, 0}, {2, 0, 0},
+    {2, 0, 0}, {3, 0, 0}, {4, 0, 0}, {5, 0, 0},
+    {6, 0, 0}, {7, 0, 0}, {8, 0, 0}, {9, 0, 0},
+    {10, 0, 0}, {11, 0, 0}, {13, 0, 0}, {14, 0, 0},
+    {16, 0, 0}, {17, 0, 0}, {19, 0, 0}, {21, 0, 0},
+    {23, 0, 0}, {25, 0, 0}, {26, 0, 0}, {27, 0, 0},
+    {28, 0, 0}, {29, 0, 0}, {30, 0, 0}, {31, 0, 0},
+    {32, 0, 0}, {33, 0, 0}, {34, 0, 0}, {35, 0, 0},
+    {36, 1, 0}, {37, 1, 0}, {38, 1, 0}, {39, 1, 0},
+    {40, 1, 0}, {41, 1, 0}, {42, 2, 0}, {43, 2, 0},
+    {44, 2, 0}, {45, 2, 0}, {46, 2, 0}, {47, 2, 0},
+    {48, 3, 0}, {49, 3, 0}, {50, 3, 0}, {51, 3, 0},
+    {52, 3, 0}, {53, 4, 0}, {54, 4, 0}, {55, 4, 0},
+    {56, 4, 0}, {57, 5, 0}, {58, 5, 0}, {59, 5, 0},
+    {60, 5, 0}, {61, 6, 0}, {62, 6, 0}, {63, 6, 0},
+    {64, 7, 0}, {65, 7, 0}, {66, 7, 0}, {67, 7, 0},
+    {68, 8, 0}, {69, 8, 0}, {70, 8, 0}, {71, 9, 0},
+    {72, 9, 0}, {73, 9, 0}, {74, 10, 0}, {75, 10, 0},
+    {76, 11, 0}, {77, 11, 0}, {78, 11, 0}, {79, 12, 0},
+    {80, 12, 0}, {81, 12, 0}, {82, 13, 0}, {83, 13, 0},
+    {84, 13, 0}, {85, 14, 0}, {86, 14, 0}, {87, 15, 0},
+    {88, 15, 0}, {89, 16, 0}, {90, 16, 0}, {91, 17, 0},
+    {92, 17, 0}, {93, 17, 0}, {94, 18, 0}, {95, 18, 0},
+    {96, 19, 0}, {97, 19, 0}, {98, 20, 0}, {99, 20, 0},
+    {100, 21, 0}, {101, 21, 0}, {102, 22, 0}, {103, 22, 0},
+    {104, 23, 0}, {105, 24, 0}, {106, 24, 0}, {107, 24, 0},
+    {108, 25, 0}, {109, 26, 0}, {110, 26, 0}, {111, 27, 0},
+    {112, 27, 0}, {113, 28, 0}, {114, 28, 0}, {115, 29, 0},
+    {116, 30, 0}, {117, 30, 0}, {118, 31, 0}, {119, 31, 0},
+    {120, 32, 0}, {121, 33, 0}, {122, 33, 0}, {123, 34, 0},
+    {124, 35, 0}, {125, 35, 0}, {126, 36, 0}, {127, 37, 0},
+    {128, 37, 0}, {129, 38, 0}, {130, 38, 0}, {131, 39, 0},
+    {132, 40, 0}, {133, 40, 0}, {134, 41, 0}, {135, 42, 0},
+    {136, 43, 0}, {137, 43, 0}, {138, 44, 0}, {139, 45, 0},
+    {140, 45, 0}, {141, 46, 0}, {142, 47, 0}, {143, 48, 0},
+    {144, 48, 0}, {145, 49, 0}, {146, 50, 0}, {147, 51, 0},
+    {148, 51, 0}, {149, 52, 0}, {150, 53, 0}, {151, 54, 0},
+    {152, 54, 0}, {153, 55, 0}, {154, 56, 0}, {155, 57, 0},
+    {156, 58, 0}, {157, 59, 0}, {158, 60, 0}, {159, 60, 0},
+    {160, 61, 0}, {161, 62, 0}, {162, 63, 0}, {163, 64, 0},
+    {164, 65, 0}, {165, 66, 0}, {166, 67, 0}, {167, 67, 0},
+    {168, 68, 0}, {169, 69, 0}, {170, 70, 0}, {171, 71, 0},
+    {172, 72, 0}, {173, 73, 0}, {174, 73, 0}, {175, 74, 0},
+    {176, 76, 0}, {177, 77, 0}, {178, 77, 0}, {179, 78, 0},
+    {180, 79, 0}, {181, 81, 0}, {182, 81, 0}, {183, 82, 0},
+    {184, 83, 0}, {185, 84, 0}, {186, 85, 0}, {187, 86, 0},
+    {188, 87, 0}, {189, 88, 0}, {190, 89, 0}, {191, 90, 0},
+    {192, 91, 0}, {193, 92, 0}, {194, 93, 0}, {195, 94, 0},
+    {196, 96, 0}, {197, 96, 0}, {198, 97, 0}, {199, 99, 0},
+    {200, 99, 0}, {201, 101, 0}, {202, 102, 0}, {203, 103, 0},
+    {204, 104, 0}, {205, 105, 0}, {206, 106, 0}, {207, 108, 0},
+    {208, 108, 0}, {209, 109, 0}, {210, 111, 0}, {211, 112, 0},
+    {212, 113, 0}, {213, 114, 0}, {214, 115, 0}, {215, 116, 0},
+    {216, 117, 0}, {217, 119, 0}, {218, 120, 0}, {219, 121, 0},
+    {220, 122, 0}, {221, 124, 0}, {222, 125, 0}, {223, 126, 0},
+    {224, 127, 0}, {225, 128, 0}, {226, 130, 0}, {227, 130, 0},
+    {228, 132, 0}, {229, 133, 0}, {230, 230, 17}, {231, 231, 16},
+    {232, 232, 16}, {233, 233, 15}, {234, 234, 14}, {235, 235, 13},
+    {236, 236, 12}, {237, 237, 13}, {238, 238, 12}, {239, 239, 11},
+    {240, 240, 10}, {241, 241, 9}, {242, 242, 9}, {243, 243, 8},
+    {244, 244, 7}, {245, 245, 6}, {246, 246, 6}, {247, 247, 5},
+    {248, 248, 4}, {249, 249, 3}, {250, 250, 2}, {251, 251, 2},
+    {252, 252, 1}, {253, 253, 0}, {254, 254, 0}, {255, 255, 0},
+};
\ No newline at end of file
@@ -0,0 +1,106 @@
+#ifndef MODE_REGISTRY_H
+#define MODE_REGISTRY_H
+
+#include <Adafruit_NeoPixel.h>
+#include <new>
+#include "LightingMode.h"
+
+// Registre statique des modes d'éclairage.
+// Un seul mode existe à la fois : il est construit sur place (placement new) dans un tampon
+// dimensionné à la compilation sur le plus gros des modes, puis détruit au changement de mode.
+// Aucun passage par le tas pour les objets modes eux-mêmes.
+// Un registre par zone de la bande : chaque registre construit ses modes sur son segment.
+//
+//   ModeRegistry<OffMode, WhiteMode> modes(&leds, &parameters);
+//   ModeRegistry<FlameMode> zone(&leds, &parameters, LedSegment(30, 60, -1));
+//   LightingMode* mode = modes.activate(1);
+
+// Taille et alignement maximaux d'une liste de types
+template <typename... Types>
+struct ModeStorageTraits;
+
+template <>
+struct ModeStorageTraits<> {
+    static const size_t size = 1;
+    static const size_t align = 1;
+};
+
+template <typename First, typename... Rest>
+struct ModeStorageTraits<First, Rest...> {
+    static const size_t size = sizeof(First) > ModeStorageTraits<Rest...>::size
+                               ? sizeof(First) : ModeStorageTraits<Rest...>::size;
+    static const size_t align = alignof(First) > ModeStorageTraits<Rest...>::align
+                                ? alignof(First) : ModeStorageTraits<Rest...>::align;
+};
+
+// Construction et empreinte du mode d'indice donné (récursion sur la liste de types)
+template <typename... Types>
+struct ModeFactory;
+
+template <>
+struct ModeFactory<> {
+    static LightingMode* create(uint8_t, void*, Adafruit_NeoPixel*, ParameterBank*, const LedSegment&) { return NULL; }
+    static size_t footprint(uint8_t) { return 0; }
+};
+
+template <typename First, typename... Rest>
+struct ModeFactory<First, Rest...> {
+    static LightingMode* create(uint8_t index, void* storage, Adafruit_NeoPixel* strip, ParameterBank* parameterBank,
+                                const LedSegment& segment) {
+        if (index == 0) {
+            return new (storage) First(strip, parameterBank, segment);
+        }
+        return ModeFactory<Rest...>::create(index - 1, storage, strip, parameterBank, segment);
+    }
+
+    static size_t footprint(uint8_t index) {
+        return index == 0 ? sizeof(First) : ModeFactory<Rest...>::footprint(index - 1);
+    }
+};
+
+template <typename... Modes>
+class ModeRegistry {
+public:
+    static const uint8_t count = sizeof...(Modes);
+    static const size_t storageSize = ModeStorageTraits<Modes...>::size;
+
+    ModeRegistry(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment())
+        : leds(strip), parameters(parameterBank), segment(ledSegment), current(NULL), currentIndex(0) {}
+
+    ~ModeRegistry() { release(); }
+
+    // Détruit le mode actif et construit le mode index à sa place
+    LightingMode* activate(uint8_t index) {
+        release();
+        currentIndex = index < count ? index : 0;
+        current = ModeFactory<Modes...>::create(currentIndex, storage, leds, parameters, segment);
+        return current;
+    }
+
+    LightingMode* active() const { return current; }
+    uint8_t activeIndex() const { return currentIndex; }
+
+    // Taille en octets de l'objet du mode index (hors allocations propres au mode)
+    static size_t footprint(uint8_t index) { return ModeFactory<Modes...>::footprint(index); }
+
+private:
+    alignas(ModeStorageTraits<Modes...>::align) unsigned char storage[ModeStorageTraits<Modes...>::size];
+    Adafruit_NeoPixel* leds;
+    ParameterBank* parameters;
+    LedSegment segment;
+    LightingMode* current;
+    uint8_t currentIndex;
+
+    void release() {
+        if (current != NULL) {
+            current->~LightingMode();
+            current = NULL;
+        }
+    }
+
+    // Pas de copie : le mode actif vit dans le tampon de cette instance
+    ModeRegistry(const ModeRegistry&);
+    ModeRegistry& operator=(const ModeRegistry&);
+};
+
+#endif // MODE_REGISTRY_H
\ No newline at end of file
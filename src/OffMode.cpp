@@ -1,12 +1,11 @@
 #include "OffMode.h"
 
-OffMode::OffMode(Adafruit_NeoPixel* strip, float* globalParam) 
-    : LightingMode(strip, globalParam) {}
+OffMode::OffMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment) 
+    : LightingMode(strip, parameterBank, ledSegment) {}
 
-void OffMode::update() {
-    // Éteindre toutes les LEDs
-    leds->clear();
-    leds->show();
+void OffMode::renderSpan(const PixelSpan& span, unsigned long /*now*/, unsigned long /*dt*/) {
+    // Éteindre les LEDs du segment
+    span.clear();
 }
 
 void OffMode::reset() {
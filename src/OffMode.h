@@ -5,9 +5,12 @@
 
 class OffMode : public LightingMode {
 public:
-    OffMode(Adafruit_NeoPixel* strip, float* globalParam);
-    void update() override;
+    OffMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
     void reset() override;
+
+    // Bande éteinte : rien à recalculer
+    unsigned long renderDelay() const override { return RENDER_NEVER; }
 };
 
 #endif // OFF_MODE_H
\ No newline at end of file
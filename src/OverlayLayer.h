@@ -0,0 +1,19 @@
+#ifndef OVERLAY_LAYER_H
+#define OVERLAY_LAYER_H
+
+#include "PixelSpan.h"
+#include "BlendKernel.h"
+
+// Couche superposée à une trame déjà rendue (voir LayerCompositor).
+// Une couche creuse ne parcourt que ses pixels actifs : au repos, elle ne coûte presque rien.
+class OverlayLayer {
+public:
+    virtual ~OverlayLayer() {}
+
+    // Fait évoluer la couche de dt ms et la fusionne dans span avec op et opacity
+    virtual void composite(const PixelSpan& span, BlendOp op, uint8_t opacity,
+                           unsigned long now, unsigned long dt) = 0;
+    virtual void reset() = 0;
+};
+
+#endif // OVERLAY_LAYER_H
\ No newline at end of file
@@ -0,0 +1,74 @@
+#ifndef PARAMETER_BANK_H
+#define PARAMETER_BANK_H
+
+#include <stdint.h>
+
+// Paramètres utilisateur, tous sur 0-100
+enum ParamId : uint8_t {
+    PARAM_GLOBAL,       // Paramètre global (appui long sur le bouton)
+    PARAM_SPEED,        // Vitesse d'animation
+    PARAM_BRIGHTNESS,   // Luminosité
+    PARAM_PALETTE,      // Choix de palette
+    PARAM_COUNT
+};
+
+// Banque de paramètres partagée par les modes. Chaque paramètre porte un numéro de version,
+// incrémenté seulement quand sa valeur change : un mode recalcule ses valeurs dérivées
+// (mapf, conversions en virgule fixe) quand la version observée diffère (voir ParamWatch),
+// et non à chaque trame.
+class ParameterBank {
+public:
+    ParameterBank() {
+        for (uint8_t i = 0; i < PARAM_COUNT; i++) {
+            values[i] = 50.0;
+            versions[i] = 1;
+        }
+    }
+
+    float get(ParamId id) const { return values[id]; }
+
+    void set(ParamId id, float value) {
+        if (value == values[id]) {
+            return;
+        }
+        values[id] = value;
+        // La version 0 est réservée à ParamWatch (« jamais lu »)
+        if (++versions[id] == 0) {
+            versions[id] = 1;
+        }
+    }
+
+    uint16_t version(ParamId id) const { return versions[id]; }
+
+private:
+    float values[PARAM_COUNT];
+    uint16_t versions[PARAM_COUNT];
+};
+
+// Indicateur de modification d'un paramètre, propre à un consommateur
+class ParamWatch {
+public:
+    explicit ParamWatch(ParamId watched) : id(watched), seenVersion(0) {}
+
+    // Vrai à la première lecture puis à chaque modification du paramètre depuis l'appel précédent
+    bool changed(const ParameterBank& bank) {
+        uint16_t current = bank.version(id);
+        if (current == seenVersion) {
+            return false;
+        }
+        seenVersion = current;
+        return true;
+    }
+
+    // Vrai si changed() retournerait vrai, sans consommer la modification
+    bool pending(const ParameterBank& bank) const { return bank.version(id) != seenVersion; }
+
+    // Force un recalcul au prochain changed()
+    void invalidate() { seenVersion = 0; }
+
+private:
+    ParamId id;
+    uint16_t seenVersion;
+};
+
+#endif // PARAMETER_BANK_H
\ No newline at end of file
@@ -0,0 +1,38 @@
+#ifndef PIXEL_SPAN_H
+#define PIXEL_SPAN_H
+
+#include <Arduino.h>
+#include <string.h>
+#include "LedConfig.h"
+#include "LedSegment.h"
+
+// Vue sur les pixels d'un segment dans un tampon au format de la bande
+// (LED_BYTES_PER_PIXEL octets par pixel, ordre des couleurs de LED_TYPE fixé à la compilation).
+// Le tampon peut être celui de la bande (getPixels(), sans copie) ou un tampon hors écran.
+struct PixelSpan {
+    uint8_t* data;      // Premier octet du pixel logique 0
+    uint16_t length;    // Nombre de pixels
+    int8_t stride;      // Octets entre deux pixels logiques consécutifs (négatif si segment inversé)
+
+    PixelSpan(uint8_t* frame, const LedSegment& segment)
+        : data(frame + segment.physical(0) * LED_BYTES_PER_PIXEL),
+          length(segment.length),
+          stride(segment.direction * LED_BYTES_PER_PIXEL) {}
+
+    PixelSpan(uint8_t* first, uint16_t count, int8_t step)
+        : data(first), length(count), stride(step) {}
+
+    // Premier octet du pixel logique i
+    uint8_t* at(uint16_t i) const { return data + (int16_t)i * stride; }
+
+    // Sens de parcours du tampon pour les noyaux de ColorKernel (1 ou -1)
+    int8_t direction() const { return stride > 0 ? 1 : -1; }
+
+    // Octet de plus faible adresse : les pixels sont contigus en mémoire quel que soit le sens
+    uint8_t* lowest() const { return stride > 0 || length == 0 ? data : at(length - 1); }
+
+    // Éteint tous les pixels
+    void clear() const { memset(lowest(), 0, length * LED_BYTES_PER_PIXEL); }
+};
+
+#endif // PIXEL_SPAN_H
\ No newline at end of file
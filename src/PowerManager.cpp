@@ -0,0 +1,197 @@
+#include "PowerManager.h"
+
+#ifdef __AVR__
+#include <avr/sleep.h>
+#include <avr/wdt.h>
+#include <avr/interrupt.h>
+
+// Compteurs du cœur Arduino (wiring.c), avancés après un sommeil profond : timer0_millis pour
+// millis(), timer0_overflow_count (un débordement de Timer0 toutes les 1024 µs) pour micros()
+extern volatile unsigned long timer0_millis;
+extern volatile unsigned long timer0_overflow_count;
+
+// Reste (µs, < 1024) des durées de sommeil pas encore converties en débordements
+static uint16_t overflowRemainder = 0;
+
+static volatile bool watchdogFired = false;
+static volatile bool pinFired = false;
+
+ISR(WDT_vect) {
+    watchdogFired = true;
+}
+
+#if POWER_WAKE_PCINT == 0
+ISR(PCINT0_vect) {
+#elif POWER_WAKE_PCINT == 1
+ISR(PCINT1_vect) {
+#else
+ISR(PCINT2_vect) {
+#endif
+    pinFired = true;
+}
+#else
+#include "SimHost.h"
+#endif
+
+// Périodes du chien de garde (ms), indice = bits WDP3..WDP0
+static const uint16_t watchdogPeriods[] = {16, 32, 64, 125, 250, 500, 1000, 2000, 4000, 8000};
+static const uint8_t watchdogPeriodCount = sizeof(watchdogPeriods) / sizeof(watchdogPeriods[0]);
+
+// Plus longue période du chien de garde qui ne dépasse pas l'échéance
+static uint8_t watchdogPeriodFor(unsigned long remaining) {
+    uint8_t period = 0;
+    while (period + 1 < watchdogPeriodCount &&
+           watchdogPeriods[period + 1] <= remaining) {
+        period++;
+    }
+    return period;
+}
+
+// Tampon d'émission logiciel vide : availableForWrite() vaut alors SERIAL_TX_BUFFER_SIZE - 1.
+// Jusqu'à deux octets peuvent encore être dans l'UART (UDR0 et registre à décalage) : voir powerDown().
+static bool serialIdle() {
+    return Serial.availableForWrite() >= SERIAL_TX_BUFFER_SIZE - 1;
+}
+
+PowerManager::PowerManager() : pin(0), deepAllowed(false) {
+    clearStats();
+}
+
+void PowerManager::begin(uint8_t wakePin) {
+    pin = wakePin;
+#ifdef __AVR__
+    deepAllowed = digitalPinToPCICRbit(wakePin) == POWER_WAKE_PCINT;
+#else
+    deepAllowed = true;
+#endif
+}
+
+void PowerManager::clearStats() {
+    statsStart = millis();
+    idleMicros = 0;
+    powerDownMicros = 0;
+    powerDownCount = 0;
+}
+
+uint32_t PowerManager::getActiveMillis() const {
+    uint32_t total = millis() - statsStart;
+    uint32_t asleep = (idleMicros + powerDownMicros) / 1000;
+    return total > asleep ? total - asleep : 0;
+}
+
+uint32_t PowerManager::averageCurrentMicroAmps() const {
+    uint64_t total = (uint64_t)(millis() - statsStart) * 1000;
+    if (total == 0) {
+        return POWER_ACTIVE_UA;
+    }
+    uint64_t asleep = idleMicros + powerDownMicros;
+    uint64_t active = total > asleep ? total - asleep : 0;
+    uint64_t charge = active * POWER_ACTIVE_UA + idleMicros * POWER_IDLE_UA + powerDownMicros * POWER_DOWN_UA;
+    return charge / total;
+}
+
+bool PowerManager::sleepUntil(unsigned long deadline, bool allowDeep) {
+    long remaining = (long)(deadline - millis());
+    if (remaining <= 0) {
+        return false;
+    }
+    if (allowDeep && deepAllowed && remaining >= POWER_DOWN_MIN_MS && serialIdle()) {
+        return powerDown(remaining);
+    }
+    idle(remaining);
+    return false;
+}
+
+#ifdef __AVR__
+
+void PowerManager::idle(unsigned long remaining) {
+    // Une seule mise en veille : la prochaine interruption (au plus 1 ms avec Timer0) rend la main
+    (void)remaining;
+    uint32_t start = micros();
+    set_sleep_mode(SLEEP_MODE_IDLE);
+    sleep_enable();
+    sleep_cpu();
+    sleep_disable();
+    idleMicros += micros() - start;
+}
+
+bool PowerManager::powerDown(unsigned long remaining) {
+    uint8_t period = watchdogPeriodFor(remaining);
+
+    // L'horloge de l'UART s'arrête en power-down : attendre la fin de l'émission (TXC0). Le tampon
+    // est déjà vide (serialIdle) : au plus deux octets restent, environ 2 ms à 9600 bauds.
+    Serial.flush();
+
+    // Réveil par changement de niveau de la broche (asynchrone, actif en power-down)
+    volatile uint8_t* pcmsk = digitalPinToPCMSK(pin);
+    uint8_t pcmskBit = _BV(digitalPinToPCMSKbit(pin));
+    uint8_t pcieBit = _BV(digitalPinToPCICRbit(pin));
+
+    cli();
+    watchdogFired = false;
+    pinFired = false;
+    PCIFR = pcieBit;
+    *pcmsk |= pcmskBit;
+    PCICR |= pcieBit;
+
+    // Chien de garde en mode interruption seule
+    MCUSR &= ~_BV(WDRF);
+    WDTCSR = _BV(WDCE) | _BV(WDE);
+    WDTCSR = _BV(WDIE) | (period & 7) | (period & 8 ? _BV(WDP3) : 0);
+
+    uint8_t adcState = ADCSRA;
+    ADCSRA &= ~_BV(ADEN);
+    set_sleep_mode(SLEEP_MODE_PWR_DOWN);
+    sleep_enable();
+    sei();
+    sleep_cpu();
+    sleep_disable();
+    ADCSRA = adcState;
+
+    cli();
+    wdt_disable();
+    *pcmsk &= ~pcmskBit;
+    PCICR &= ~pcieBit;
+    bool byPin = pinFired && !watchdogFired;
+    if (!byPin) {
+        // Timer0 était arrêté : rattraper la durée nominale du sommeil, sur millis() et micros()
+        // ensemble pour qu'ils restent cohérents (gigue du profileur : micros() contre millis())
+        uint32_t slept = (uint32_t)watchdogPeriods[period] * 1000 + overflowRemainder;
+        timer0_millis += watchdogPeriods[period];
+        timer0_overflow_count += slept >> 10;
+        overflowRemainder = slept & 0x3FF;
+        powerDownMicros += (uint32_t)watchdogPeriods[period] * 1000;
+    }
+    sei();
+
+    // Réveil par la broche : durée inconnue (le chien de garde n'a pas de compteur lisible), au
+    // plus une période. Elle n'est ajoutée ni aux horloges ni aux statistiques : millis() et
+    // micros() retardent ensemble d'au plus une période par appui qui réveille. Les fronts du
+    // bouton sont horodatés après le réveil, sur cette même horloge : l'anti-rebond et les durées
+    // d'appui n'en dépendent pas.
+    powerDownCount++;
+    return byPin;
+}
+
+#else
+
+// Hôte : mêmes réveils que sur la cible, sur l'horloge virtuelle du simulateur
+
+void PowerManager::idle(unsigned long remaining) {
+    // Comme sleep_cpu() : l'interruption de Timer0 réveille au tic suivant, quelle que soit l'échéance
+    (void)remaining;
+    uint64_t start = simTimeMicros();
+    simSleepUntil((start / 1000 + 1) * 1000);
+    idleMicros += simTimeMicros() - start;
+}
+
+bool PowerManager::powerDown(unsigned long remaining) {
+    // Réveil par le chien de garde après sa période, ou plus tôt par la broche
+    uint64_t start = simTimeMicros();
+    bool byPin = simSleepUntil(start + (uint64_t)watchdogPeriods[watchdogPeriodFor(remaining)] * 1000);
+    powerDownMicros += simTimeMicros() - start;
+    powerDownCount++;
+    return byPin;
+}
+
+#endif
\ No newline at end of file
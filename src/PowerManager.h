@@ -0,0 +1,71 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+
+// Estimation du courant du microcontrôleur seul (ATmega328P à 16 MHz sous 5 V, en µA), sans la
+// bande : chaque WS2812 consomme environ 1 mA même éteinte. À ajuster par -D pour la carte réelle.
+#ifndef POWER_ACTIVE_UA
+#define POWER_ACTIVE_UA 10000
+#endif
+#ifndef POWER_IDLE_UA
+#define POWER_IDLE_UA 3000
+#endif
+#ifndef POWER_DOWN_UA
+#define POWER_DOWN_UA 10        // Chien de garde actif
+#endif
+
+#define POWER_DOWN_MIN_MS 100   // Attente minimale pour passer en sommeil profond
+
+// Groupe d'interruptions de changement de niveau de la broche de réveil (Uno : 0 = D8..D13,
+// 1 = A0..A5, 2 = D0..D7). Seul ce vecteur est défini, les autres restent libres.
+#ifndef POWER_WAKE_PCINT
+#define POWER_WAKE_PCINT 2
+#endif
+
+// Mise en veille du microcontrôleur entre deux échéances.
+// Veille légère (idle) : Timer0 continue, millis() reste exact ; toute interruption réveille
+// (Timer0 chaque milliseconde, bouton, port série), la boucle reprend et se rendort.
+// Sommeil profond (power-down) : pour les longues attentes, réveil par le chien de garde ou par
+// un changement de niveau de la broche du bouton. millis() et micros() sont avancés de la période
+// du chien de garde (précision de l'ordre de 10 %) ; un réveil par la broche n'avance pas
+// l'horloge (durée inconnue, au plus une période). Le simulateur, à horloge unique, n'a pas ce
+// retard. Une seule instance (routines d'interruption).
+class PowerManager {
+public:
+    PowerManager();
+
+    // wakePin : broche dont un changement de niveau réveille du sommeil profond. Hors du groupe
+    // POWER_WAKE_PCINT, le sommeil profond est désactivé (aucun réveil par la broche).
+    void begin(uint8_t wakePin);
+
+    // Dort au plus jusqu'à deadline (millis). allowDeep autorise le sommeil profond : à refuser
+    // tant qu'un appui est en cours. Tant que le port série émet, la veille reste légère (l'UART
+    // s'arrête en power-down) : on attend que le tampon se vide plutôt que de bloquer sur flush().
+    // Retourne true si le réveil vient de la broche pendant un sommeil profond : INT0 ne voit pas
+    // ce front (détection de front arrêtée), le niveau doit être relu (ButtonHandler::poll()).
+    bool sleepUntil(unsigned long deadline, bool allowDeep);
+
+    // Temps passé dans chaque état depuis clearStats()
+    uint32_t getActiveMillis() const;
+    uint32_t getIdleMillis() const { return idleMicros / 1000; }
+    uint32_t getPowerDownMillis() const { return powerDownMicros / 1000; }
+    unsigned long getPowerDownCount() const { return powerDownCount; }
+
+    // Courant moyen estimé (µA) depuis clearStats(), d'après les constantes POWER_*_UA
+    uint32_t averageCurrentMicroAmps() const;
+    void clearStats();
+
+private:
+    uint8_t pin;
+    bool deepAllowed;              // Broche de réveil servie par le vecteur POWER_WAKE_PCINT
+    unsigned long statsStart;      // millis() au dernier clearStats()
+    uint64_t idleMicros;
+    uint64_t powerDownMicros;
+    unsigned long powerDownCount;
+
+    void idle(unsigned long remaining);
+    bool powerDown(unsigned long remaining);
+};
+
+#endif // POWER_MANAGER_H
\ No newline at end of file
@@ -0,0 +1,51 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <Arduino.h>
+
+// File circulaire sans verrou, un seul producteur (interruption) et un seul consommateur (loop).
+// Chaque indice n'est écrit que par un côté ; sur AVR un uint8_t se lit et s'écrit en une
+// instruction, ce qui suffit à publier un élément sans masquer les interruptions.
+// Capacity doit être une puissance de deux ; une case reste libre pour distinguer plein et vide.
+template <typename T, uint8_t Capacity>
+class SpscQueue {
+public:
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity doit être une puissance de deux");
+
+    SpscQueue() : head(0), tail(0) {}
+
+    // Côté producteur. Retourne false si la file est pleine (élément perdu).
+    bool push(const T& item) {
+        uint8_t next = (head + 1) & (Capacity - 1);
+        if (next == tail) {
+            return false;
+        }
+        items[head] = item;
+        compilerBarrier();
+        head = next;  // Publication après l'écriture de l'élément
+        return true;
+    }
+
+    // Côté consommateur. Retourne false si la file est vide.
+    bool pop(T& item) {
+        if (tail == head) {
+            return false;
+        }
+        item = items[tail];
+        compilerBarrier();
+        tail = (tail + 1) & (Capacity - 1);
+        return true;
+    }
+
+    bool empty() const { return tail == head; }
+
+private:
+    // Empêche le compilateur de déplacer l'accès à l'élément au-delà de la mise à jour de l'indice
+    static inline void compilerBarrier() { asm volatile("" ::: "memory"); }
+
+    T items[Capacity];
+    volatile uint8_t head;  // Écrit par le producteur
+    volatile uint8_t tail;  // Écrit par le consommateur
+};
+
+#endif // SPSC_QUEUE_H
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "StarOverlay.h"
+
+StarOverlay::StarOverlay(EnvelopeEngine& engine, uint32_t seed) : stars(engine), rng(seed) {
+    setProbability(0.00005, 8);
+    starPeakMax = 255;
+    riseCurve = CURVE_LINEAR;
+    fallCurve = CURVE_LINEAR;
+    reset();
+}
+
+void StarOverlay::setProbability(float probability, uint16_t periodMs) {
+    starThreshold = FastRandom::probability(probability / periodMs);
+}
+
+void StarOverlay::composite(const PixelSpan& span, BlendOp op, uint8_t opacity,
+                            unsigned long now, unsigned long dt) {
+    (void)now; // Les enveloppes avancent de la durée de la trame
+
+    // Animation des étoiles en cours ; les étoiles terminées libèrent leur place
+    stars.advance(dt);
+
+    // Naissance : un seul tirage pour toute la portée et toute la trame (probabilité par LED et
+    // par ms × nombre de LEDs × dt), puis une LED au hasard, au lieu d'un tirage par LED
+    uint32_t spanThreshold = FastRandom::scaledThreshold(
+        FastRandom::scaledThreshold(starThreshold, span.length), dt);
+    if (span.length > 0 && rng.chance(spanThreshold)) {
+        uint16_t index = rng.below(span.length);
+        if (!stars.full() && !stars.contains(index)) {
+            spawn(index);
+        }
+    }
+
+    // Étoiles fusionnées en blanc
+    for (uint8_t s = 0; s < stars.active(); s++) {
+        const Envelope& star = stars[s];
+        if (star.tag < span.length) {
+            blendPixel(span.at(star.tag), star.level, star.level, star.level, op, opacity);
+        }
+    }
+}
+
+void StarOverlay::reset() {
+    // Libérer tous les emplacements d'étoile
+    stars.clear();
+}
+
+void StarOverlay::spawn(uint16_t index) {
+    EnvelopeShape shape;
+    shape.attack = rng.range(starMinRiseTime, starMaxRiseTime);
+    shape.hold = 0;
+    shape.decay = rng.range(starMinFallTime, starMaxFallTime);
+
+    // Intensités de début et de fin pour l'animation
+    shape.startLevel = rng.range(starMinIntensityStart, starMaxIntensityStart);
+    shape.peakLevel = rng.range(starPeakMax / 2, starPeakMax + 1);
+    shape.attackCurve = riseCurve;
+    shape.decayCurve = fallCurve;
+
+    stars.start(shape, index);
+}
\ No newline at end of file
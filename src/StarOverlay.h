@@ -0,0 +1,47 @@
+#ifndef STAR_OVERLAY_H
+#define STAR_OVERLAY_H
+
+#include "OverlayLayer.h"
+#include "EnvelopeEngine.h"
+#include "FastRandom.h"
+
+// Couche creuse d'étoiles : quelques LEDs s'allument en blanc (montée puis descente) puis s'éteignent.
+// Chaque étoile est une enveloppe du moteur fourni, étiquetée par sa LED : une trame ne parcourt
+// que les étoiles actives et, au repos, ne coûte qu'un seul tirage. Le nombre d'étoiles
+// simultanées est la capacité du moteur.
+class StarOverlay : public OverlayLayer {
+public:
+    explicit StarOverlay(EnvelopeEngine& engine, uint32_t seed = 0x57A2F00DUL);
+    void composite(const PixelSpan& span, BlendOp op, uint8_t opacity,
+                   unsigned long now, unsigned long dt) override;
+    void reset() override;
+
+    // Probabilité pour une LED d'entrer en mode étoile par période de periodMs. Le tirage de
+    // chaque trame est ramené à sa durée (dt) : la fréquence des étoiles ne dépend pas de la cadence.
+    void setProbability(float probability, uint16_t periodMs);
+    // Borne haute de l'intensité au sommet (0-255), tirée dans [peakMax / 2, peakMax]
+    void setPeakMax(uint8_t peakMax) { starPeakMax = peakMax; }
+    // Courbes de montée et de descente (linéaires par défaut)
+    void setCurves(EnvelopeCurve rise, EnvelopeCurve fall) { riseCurve = rise; fallCurve = fall; }
+
+private:
+    // Bornes des tirages d'une étoile
+    static const uint8_t starMinIntensityStart = 0;     // Intensité de départ (0-255)
+    static const uint8_t starMaxIntensityStart = 26;    // 0.1
+    static const uint16_t starMinRiseTime = 50;         // Temps de montée (ms)
+    static const uint16_t starMaxRiseTime = 500;
+    static const uint16_t starMinFallTime = 100;        // Temps de descente (ms)
+    static const uint16_t starMaxFallTime = 1000;
+
+    EnvelopeEngine& stars;
+    FastRandom rng;
+
+    uint32_t starThreshold;               // Seuil FastRandom::chance() par LED et par milliseconde
+    uint8_t starPeakMax;
+    EnvelopeCurve riseCurve;
+    EnvelopeCurve fallCurve;
+
+    void spawn(uint16_t index);
+};
+
+#endif // STAR_OVERLAY_H
\ No newline at end of file
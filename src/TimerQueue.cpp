@@ -0,0 +1,60 @@
+#include "TimerQueue.h"
+
+bool TimerQueue::schedule(uint8_t id, uint32_t deadline) {
+    cancel(id);
+    if (count == capacity) {
+        return false;
+    }
+
+    // Insertion en gardant l'ordre : les échéances plus proches que deadline se décalent vers la tête
+    uint8_t i = count;
+    while (i > 0 && (int32_t)(slots[i - 1].deadline - deadline) < 0) {
+        slots[i] = slots[i - 1];
+        i--;
+    }
+    slots[i].deadline = deadline;
+    slots[i].id = id;
+    count++;
+    return true;
+}
+
+void TimerQueue::cancel(uint8_t id) {
+    for (uint8_t i = 0; i < count; i++) {
+        if (slots[i].id == id) {
+            remove(i);
+            return;
+        }
+    }
+}
+
+bool TimerQueue::poll(uint32_t now, uint8_t& id) {
+    if (count == 0 || !timeReached(now, slots[count - 1].deadline)) {
+        return false;
+    }
+    id = slots[--count].id;
+    return true;
+}
+
+bool TimerQueue::nextDeadline(uint32_t& deadline) const {
+    if (count == 0) {
+        return false;
+    }
+    deadline = slots[count - 1].deadline;
+    return true;
+}
+
+bool TimerQueue::pending(uint8_t id) const {
+    for (uint8_t i = 0; i < count; i++) {
+        if (slots[i].id == id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void TimerQueue::remove(uint8_t index) {
+    for (uint8_t i = index + 1; i < count; i++) {
+        slots[i - 1] = slots[i];
+    }
+    count--;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#ifndef TIMER_QUEUE_H
+#define TIMER_QUEUE_H
+
+#include <Arduino.h>
+
+// Comparaison d'instants sûre au rebouclage de millis() (49,7 jours) : vrai si now a atteint
+// deadline. Valable tant que les deux instants sont à moins de 2^31 ms (24,8 jours) l'un de l'autre.
+inline bool timeReached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+// Échéance programmée, identifiée par un numéro choisi par l'appelant
+struct Timer {
+    uint32_t deadline;         // Instant d'expiration (millis, 32 bits)
+    uint8_t id;
+};
+
+// File d'échéances triée : la plus proche est en tête, une trame sans expiration ne coûte
+// qu'une comparaison. Chaque appel à poll() rend une échéance expirée, dans l'ordre des
+// instants, et la retire de la file.
+//
+//   TimerPool<2> timers;
+//   timers.scheduleIn(TIMER_STRENGTH, now, 1500);
+//   uint8_t id;
+//   while (timers.poll(now, id)) { ... }
+//
+// Le stockage est fourni par TimerPool<N> ; les numéros sont uniques (reprogrammer remplace).
+class TimerQueue {
+public:
+    TimerQueue(Timer* storage, uint8_t capacity) : slots(storage), capacity(capacity), count(0) {}
+
+    // Programme (ou reprogramme) le numéro id. Retourne false si la file est pleine.
+    bool schedule(uint8_t id, uint32_t deadline);
+    bool scheduleIn(uint8_t id, uint32_t now, uint32_t delay) { return schedule(id, now + delay); }
+    void cancel(uint8_t id);
+
+    // Retire la première échéance atteinte à now et rend son numéro. Retourne false s'il n'y en a pas.
+    bool poll(uint32_t now, uint8_t& id);
+
+    // Échéance la plus proche. Retourne false si la file est vide.
+    bool nextDeadline(uint32_t& deadline) const;
+
+    bool pending(uint8_t id) const;
+    void clear() { count = 0; }
+    uint8_t size() const { return count; }
+
+private:
+    // Triées de la plus lointaine à la plus proche : la tête est slots[count - 1]
+    Timer* slots;
+    uint8_t capacity;
+    uint8_t count;
+
+    void remove(uint8_t index);
+};
+
+// Stockage de N échéances (N ≤ 255)
+template <uint8_t N>
+class TimerPool : public TimerQueue {
+public:
+    TimerPool() : TimerQueue(storage, N) {}
+
+private:
+    Timer storage[N];
+};
+
+#endif // TIMER_QUEUE_H
\ No newline at end of file
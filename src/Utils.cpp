@@ -1,10 +1,19 @@
 #include "Utils.h"
 #include <Arduino.h>
 
-float randomFloat(float min, float max) {
-    return min + ((float)random(0, 10000) / 10000.0) * (max - min);
-}
-
 float mapf(float x, float in_min, float in_max, float out_min, float out_max) {
     return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+uint32_t bootEntropy() {
+#ifdef __AVR__
+    // Bits de poids faible d'une entrée en l'air (bruit thermique, rayonnement du secteur)
+    uint32_t value = 0;
+    for (uint8_t i = 0; i < 32; i++) {
+        value = ((value << 1) | (value >> 31)) ^ analogRead(ENTROPY_PIN);
+    }
+    return value;
+#else
+    return 0; // Simulateur : animations reproductibles
+#endif
 }
\ No newline at end of file
@@ -1,7 +1,16 @@
 #ifndef UTILS_H
 #define UTILS_H
 
-float randomFloat(float min, float max);
+#include <stdint.h>
+
+// Entrée analogique laissée en l'air, source du bruit de démarrage
+#ifndef ENTROPY_PIN
+#define ENTROPY_PIN A0
+#endif
+
 float mapf(float x, float in_min, float in_max, float out_min, float out_max);
 
+// Valeur différente à chaque mise sous tension (bruit de ENTROPY_PIN) sur la cible, 0 sur l'hôte
+uint32_t bootEntropy();
+
 #endif // UTILS_H
\ No newline at end of file
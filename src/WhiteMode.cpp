@@ -1,19 +1,21 @@
 #include "WhiteMode.h"
 #include "Utils.h"
+#include "ColorKernel.h"
 
-WhiteMode::WhiteMode(Adafruit_NeoPixel* strip, float* globalParam) 
-    : LightingMode(strip, globalParam) {}
+WhiteMode::WhiteMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment) 
+    : LightingMode(strip, parameterBank, ledSegment), globalWatch(PARAM_GLOBAL), brightness(0) {}
 
-void WhiteMode::update() {
-    // Utiliser le paramètre global pour ajuster l'intensité (0 à 100)
-    uint8_t brightness = mapf(*globalParameter, 0.0, 100.0, 0, 255);
-
-    // Allumer toutes les LED en blanc avec l'intensité définie
-    for (int i = 0; i < leds->numPixels(); i++) {
-        leds->setPixelColor(i, leds->Color(brightness, brightness, brightness));
+void WhiteMode::renderSpan(const PixelSpan& span, unsigned long /*now*/, unsigned long /*dt*/) {
+    // Utiliser le paramètre global pour ajuster l'intensité (0 à 100), recalculée s'il a changé
+    if (globalWatch.changed(*parameters)) {
+        brightness = mapf(parameters->get(PARAM_GLOBAL), 0.0, 100.0, 0, 255);
     }
 
-    leds->show();
+    // Allumer toutes les LED du segment en blanc avec l'intensité définie
+    uint8_t* pixel = span.data;
+    for (uint16_t i = 0; i < span.length; i++, pixel += span.stride) {
+        rgbToPixel(pixel, brightness, brightness, brightness);
+    }
 }
 
 void WhiteMode::reset() {
@@ -2,12 +2,20 @@
 #define WHITE_MODE_H
 
 #include "LightingMode.h"
+#include "LedConfig.h"
 
 class WhiteMode : public LightingMode {
 public:
-    WhiteMode(Adafruit_NeoPixel* strip, float* globalParam);
-    void update() override;
+    WhiteMode(Adafruit_NeoPixel* strip, ParameterBank* parameterBank, const LedSegment& ledSegment = LedSegment());
+    void renderSpan(const PixelSpan& span, unsigned long now, unsigned long dt) override;
     void reset() override;
+
+    // Image fixe : à rendre seulement quand le paramètre global change
+    unsigned long renderDelay() const override { return globalWatch.pending(*parameters) ? 0 : RENDER_NEVER; }
+
+private:
+    ParamWatch globalWatch;
+    uint8_t brightness;      // Intensité dérivée du paramètre global
 };
 
 #endif // WHITE_MODE_H
\ No newline at end of file
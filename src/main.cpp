@@ -2,39 +2,64 @@
 #include <Adafruit_NeoPixel.h>
 
 // Inclusion des fichiers d’en-tête
+#include "LedConfig.h"
 #include "LightingMode.h"
 #include "OffMode.h"
 #include "WhiteMode.h"
 #include "BlueFlickerMode.h"
 #include "FlameMode.h"
 #include "GradientMode.h"
+#include "FireMode.h"
+#include "ModeRegistry.h"
+#include "ParameterBank.h"
 #include "ButtonHandler.h"
+#include "FrameScheduler.h"
+#include "FrameProfiler.h"
+#include "PowerManager.h"
+#include "Logger.h"
+#include "LookupTables.h"
 #include "Utils.h"
 
 // Définition des broches et paramètres généraux
 #define PIN        6        // Pin de contrôle des LED
-#define NUM_LEDS   10       // Nombre de LED
 #define BUTTON_PIN 2        // Broche du bouton
+#define TARGET_FPS 50       // Cadence cible des trames
 
 // Création de l'objet NeoPixel
-Adafruit_NeoPixel leds(NUM_LEDS, PIN, NEO_GRB + NEO_KHZ800);
+Adafruit_NeoPixel leds(LED_COUNT, PIN, LED_TYPE);
 
 // Gestionnaire de bouton
 ButtonHandler buttonHandler(BUTTON_PIN);
 
-// Paramètre global ajustable
-float globalParameter = 50.0; // Initialisé à 50
+// Ordonnanceur des trames (seul responsable de leds.show())
+FrameScheduler frameScheduler(&leds, TARGET_FPS);
+
+// Profileur des trames (télémétrie binaire sur le port série, voir tools/decode_telemetry.py)
+FrameProfiler frameProfiler;
+
+// Mise en veille entre les trames
+PowerManager powerManager;
+
+// Paramètres ajustables (paramètre global initialisé à 50)
+ParameterBank parameters;
 
 // Variables pour l'ajustement du paramètre global
 bool isAdjustingParameter = false;
 unsigned long parameterLastUpdateTime = 0;
 float baseSpeed = 0.75;
 float exponentialFactor = 1.5;
+const float maxDynamicSpeed = 1.0e6; // rad/s, bien au-delà de tout rendu visible (repliement)
 unsigned long buttonPressedTime = 0;
 
-// Tableau des modes d'éclairage
-const int totalModes = 5; // Augmenté à 5 pour inclure le nouveau mode
-LightingMode* modes[totalModes];
+// Modes d'éclairage : seul le mode actif est construit, dans un tampon statique
+typedef ModeRegistry<OffMode, WhiteMode, BlueFlickerMode, FlameMode, GradientMode, FireMode> Modes;
+Modes modes(&leds, &parameters);
+// Globales du croquis hors tampon de la bande et stockage des modes (voir LedConfig.h)
+static const size_t sketchGlobalBytes = sizeof(leds) + sizeof(buttonHandler) + sizeof(frameScheduler) +
+    sizeof(frameProfiler) + sizeof(powerManager) + sizeof(parameters) + sizeof(logger) +
+    (sizeof(modes) - Modes::storageSize);
+static_assert(LED_RAM_FITS(Modes::storageSize, sketchGlobalBytes), "LED_COUNT trop grand : bande, mode actif et globales dépassent le budget RAM");
+const int totalModes = Modes::count;
 int currentModeIndex = 1; // Initialisé à 1 (blanc)
 
 // Fonction pour mettre à jour le paramètre global
@@ -48,18 +73,20 @@ void setup() {
     // Initialisation du port série pour le débogage
     Serial.begin(9600);
 
-    // Initialisation des modes d'éclairage
-    modes[0] = new OffMode(&leds, &globalParameter);
-    modes[1] = new WhiteMode(&leds, &globalParameter);
-    modes[2] = new BlueFlickerMode(&leds, &globalParameter);
-    modes[3] = new FlameMode(&leds, &globalParameter);
-    modes[4] = new GradientMode(&leds, &globalParameter);
-
     // Initialisation du gestionnaire de bouton
     buttonHandler.begin();
+    powerManager.begin(BUTTON_PIN);
 
-    // Réinitialiser le mode actuel
-    modes[currentModeIndex]->reset();
+    // Mesure des trames
+    frameScheduler.setProfiler(&frameProfiler);
+
+    // Graines des modes différentes à chaque mise sous tension
+    FastRandom::addEntropy(bootEntropy());
+
+    // Construction du mode initial
+    modes.activate(currentModeIndex);
+    frameScheduler.reset();
+    LOG(LOG_LEVEL_INFO, "Stockage des modes (octets) : ", (long)Modes::storageSize);
 }
 
 void loop() {
@@ -69,19 +96,22 @@ void loop() {
     if (event == ButtonEvent::ShortPress) {
         // Changement de mode sur appui court
         currentModeIndex = (currentModeIndex + 1) % totalModes;
-        Serial.print("Changement de mode : ");
-        Serial.println(currentModeIndex);
-        modes[currentModeIndex]->reset();
+        LOG(LOG_LEVEL_INFO, "Courant moyen estimé du mode (µA) : ", (long)powerManager.averageCurrentMicroAmps());
+        LOG(LOG_LEVEL_INFO, "Changement de mode : ", currentModeIndex);
+        powerManager.clearStats();
+        FastRandom::addEntropy(micros()); // Instant de l'appui : chaque activation diffère
+        modes.activate(currentModeIndex);
+        frameScheduler.reset();
     } else if (event == ButtonEvent::LongPressStart) {
         // Début de l'ajustement du paramètre global
         isAdjustingParameter = true;
         parameterLastUpdateTime = millis();
         buttonPressedTime = millis();
-        Serial.println("Début de l'ajustement du paramètre global");
+        LOG(LOG_LEVEL_INFO, "Début de l'ajustement du paramètre global");
     } else if (event == ButtonEvent::LongPressEnd) {
         // Fin de l'ajustement du paramètre global
         isAdjustingParameter = false;
-        Serial.println("Fin de l'ajustement du paramètre global");
+        LOG(LOG_LEVEL_INFO, "Fin de l'ajustement du paramètre global");
     }
 
     // Mise à jour du paramètre global si en ajustement
@@ -89,8 +119,29 @@ void loop() {
         updateGlobalParameter();
     }
 
-    // Mise à jour du mode actuel
-    modes[currentModeIndex]->update();
+    // Rendu et envoi de la trame du mode actuel à cadence fixe
+    frameScheduler.update(modes.active());
+
+    // Période de boucle et envoi de la télémétrie
+    frameProfiler.update(frameScheduler);
+
+    // Écriture des messages en attente, sans bloquer
+    logger.drain();
+
+    // Veille jusqu'à la prochaine trame utile ou la prochaine échéance du bouton.
+    // Pendant l'ajustement, le paramètre change à chaque tour : une trame par créneau.
+    unsigned long wakeTime = frameScheduler.wakeTime(modes.active(), isAdjustingParameter);
+    unsigned long buttonTime;
+    bool buttonIdle = !buttonHandler.nextDeadline(buttonTime);
+    if (!buttonIdle && (long)(wakeTime - buttonTime) > 0) {
+        wakeTime = buttonTime;
+    }
+    uint32_t sleepStart = micros();
+    bool pinWake = powerManager.sleepUntil(wakeTime, buttonIdle && !logger.pending());
+    frameProfiler.recordSleep(micros() - sleepStart);
+    if (pinWake) {
+        buttonHandler.poll();
+    }
 }
 
 // Fonction pour mettre à jour le paramètre global
@@ -103,19 +154,23 @@ void updateGlobalParameter() {
     // Calculer le facteur de variation exponentielle en fonction de la durée de l'appui long
     unsigned long pressDuration = millis() - buttonPressedTime;
     float dynamicSpeed = baseSpeed * pow(exponentialFactor, pressDuration / 1000.0); // Variation exponentielle avec le temps d'appui
-
-    // Mettre à jour le phase en fonction de la vitesse dynamique
-    static float phase = 0.0;
-    phase += dynamicSpeed * (elapsedTime / 1000.0); // Convertir le temps en secondes
-
-    if (phase > TWO_PI) {
-        phase -= TWO_PI;
+    if (dynamicSpeed > maxDynamicSpeed) {
+        dynamicSpeed = maxDynamicSpeed; // Reste fini même après plusieurs minutes d'appui
     }
 
-    // Calculer le paramètre entre 0 et 100
-    globalParameter = (sin(phase) + 1.0) * 50.0; // sin() varie entre -1 et 1, donc (sin() + 1) varie entre 0 à 2, multiplié par 50 donne 0 à 100
-
-    // Afficher la valeur du paramètre dans la console série
-    Serial.print("Paramètre global ajusté à : ");
-    Serial.println(globalParameter);
+    // Mettre à jour la phase en fonction de la vitesse dynamique
+    // Accumulateur 32 bits : un tour (2π) = 2^32, les 16 bits de poids fort donnent la phase du sinus.
+    // L'incrément est ramené à moins d'un tour avant la conversion : après un long appui ou une
+    // longue trame, il dépasse 2^32 et la conversion en uint32_t serait indéfinie. fmod est exact,
+    // le reste est strictement inférieur à 2^32.
+    static uint32_t phase = 0;
+    float increment = dynamicSpeed * elapsedTime * (4294967296.0 / (TWO_PI * 1000.0)); // rad/s × ms → unités de phase
+    phase += (uint32_t)fmod(increment, 4294967296.0);
+
+    // Calculer le paramètre entre 0 et 100 : (sin + 1) / 2 varie entre 0 et 1, multiplié par 100
+    float globalParameter = unitToFloat(lutSinUnit(phase >> 16)) * 100.0;
+    parameters.set(PARAM_GLOBAL, globalParameter);
+
+    // Afficher la valeur du paramètre dans la console série (au plus 5 fois par seconde)
+    LOG_EVERY(LOG_LEVEL_INFO, 200, "Paramètre global ajusté à : ", globalParameter);
 }
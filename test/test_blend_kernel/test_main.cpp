@@ -0,0 +1,120 @@
+// Noyau de fusion comparé à un calcul de référence exact (pio test -e native)
+
+#include <unity.h>
+#include <string.h>
+#include "BlendKernel.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Sur AVR, int et unsigned font 16 bits : un produit d'opérandes uint16_t est non signé
+// (0-65535), celui de deux int est signé (au plus 32767). L'hôte a des int de 32 bits et ne
+// déborde jamais : les produits intermédiaires du noyau sont donc recalculés ici sur 32 bits
+// et comparés aux bornes du type qu'ils ont sur AVR.
+static const int32_t AVR_INT_MAX = 32767;
+static const int32_t AVR_UNSIGNED_MAX = 65535;
+
+// Résultat attendu, calculé sur 32 bits, avec le décompte des intermédiaires hors bornes AVR
+static uint8_t referenceBlend(uint8_t dst, uint8_t src, BlendOp op, uint8_t opacity, uint32_t& overflows) {
+    int32_t weight = opacity + 1;
+    int32_t alpha = opacity + (opacity >> 7);
+    int32_t scaled = src * weight;                          // uint8_t * uint16_t : non signé
+    int32_t result;
+
+    switch (op) {
+        case BLEND_ADD:
+            result = dst + (scaled >> 8);
+            result = result > 255 ? 255 : result;
+            break;
+        case BLEND_MAX:
+            result = (scaled >> 8) > dst ? (scaled >> 8) : dst;
+            break;
+        case BLEND_ALPHA:
+            scaled = dst * (256 - alpha) + src * alpha;     // Opérandes uint16_t : non signé
+            result = scaled >> 8;
+            break;
+        default: {
+            int32_t product = (255 - dst) * (256 - src);    // uint16_t * uint16_t : non signé
+            if (product > AVR_UNSIGNED_MAX) {
+                overflows++;
+            }
+            int32_t screen = 255 - (product >> 8);
+            scaled = dst * (256 - alpha) + screen * alpha;
+            result = scaled >> 8;
+            break;
+        }
+    }
+    if (scaled > AVR_UNSIGNED_MAX) {
+        overflows++;
+    }
+    return result;
+}
+
+// Toutes les valeurs de dst, src et opacité, pour chaque opération
+static void assertEveryInput(BlendOp op) {
+    uint32_t mismatches = 0;
+    uint32_t overflows = 0;
+    for (uint16_t dst = 0; dst < 256; dst++) {
+        for (uint16_t src = 0; src < 256; src++) {
+            for (uint16_t opacity = 0; opacity < 256; opacity++) {
+                if (blendChannel(dst, src, op, opacity) != referenceBlend(dst, src, op, opacity, overflows)) {
+                    mismatches++;
+                }
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, mismatches);
+    TEST_ASSERT_EQUAL_UINT32(0, overflows);
+}
+
+void test_add_every_input(void) { assertEveryInput(BLEND_ADD); }
+void test_max_every_input(void) { assertEveryInput(BLEND_MAX); }
+void test_alpha_every_input(void) { assertEveryInput(BLEND_ALPHA); }
+void test_screen_every_input(void) { assertEveryInput(BLEND_SCREEN); }
+
+// Le produit du screen dépasse un int de 16 bits : sans conversion en uint16_t de ses
+// opérandes, il déborderait sur AVR (comportement indéfini)
+void test_screen_product_needs_unsigned(void) {
+    TEST_ASSERT_TRUE((int32_t)255 * 256 > AVR_INT_MAX);
+    TEST_ASSERT_EQUAL_UINT8(0, blendChannel(0, 0, BLEND_SCREEN, 255));
+    TEST_ASSERT_EQUAL_UINT8(255, blendChannel(0, 255, BLEND_SCREEN, 255));
+    TEST_ASSERT_EQUAL_UINT8(255, blendChannel(255, 0, BLEND_SCREEN, 255));
+}
+
+// Les mots de 32 bits de blendSpan() donnent le même résultat que blendChannel() octet par
+// octet, y compris pour le reste d'une longueur qui n'est pas multiple de 4
+void test_span_matches_channel(void) {
+    static const uint16_t count = 103;
+    static const uint8_t opacities[] = {0, 1, 64, 127, 128, 200, 254, 255};
+    uint8_t src[count], dst[count], expected[count];
+    uint32_t seed = 12345;
+    for (uint16_t i = 0; i < count; i++) {
+        seed = seed * 1103515245UL + 12345;
+        src[i] = seed >> 16;
+        seed = seed * 1103515245UL + 12345;
+        dst[i] = seed >> 16;
+    }
+
+    for (uint8_t op = BLEND_ADD; op <= BLEND_SCREEN; op++) {
+        for (uint8_t o = 0; o < sizeof(opacities); o++) {
+            for (uint16_t i = 0; i < count; i++) {
+                expected[i] = blendChannel(dst[i], src[i], (BlendOp)op, opacities[o]);
+            }
+            uint8_t result[count];
+            memcpy(result, dst, count);
+            blendSpan(result, src, count, (BlendOp)op, opacities[o]);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, result, count);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_add_every_input);
+    RUN_TEST(test_max_every_input);
+    RUN_TEST(test_alpha_every_input);
+    RUN_TEST(test_screen_every_input);
+    RUN_TEST(test_screen_product_needs_unsigned);
+    RUN_TEST(test_span_matches_channel);
+    return UNITY_END();
+}
\ No newline at end of file
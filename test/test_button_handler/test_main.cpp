@@ -0,0 +1,173 @@
+// Machine à états de ButtonHandler sur des fronts rejoués par onEdge() (pio test -e native)
+
+#include <unity.h>
+#include <Arduino.h>
+#include "SimHost.h"
+#include "ButtonHandler.h"
+
+// Événement reçu et instant (millis) de l'appel à update() qui l'a rendu
+struct Received {
+    ButtonEvent event;
+    unsigned long time;
+};
+
+static const uint8_t maxReceived = 16;
+static Received received[maxReceived];
+static uint8_t receivedCount;
+
+void setUp(void) {
+    simSetTimeMicros(0);
+    simSetSerialEcho(false);
+    receivedCount = 0;
+}
+
+void tearDown(void) {}
+
+// Rejoue les fronts à leur instant, en appelant update() à chaque milliseconde jusqu'à end
+static void replay(ButtonHandler& button, const ButtonEdge* script, uint8_t length, unsigned long end) {
+    uint8_t next = 0;
+    for (unsigned long t = 0; t <= end; t++) {
+        simSetTimeMicros((uint64_t)t * 1000);
+        while (next < length && script[next].time == t) {
+            button.onEdge(script[next].time, script[next].pressed);
+            next++;
+        }
+        ButtonEvent event;
+        while ((event = button.update()) != ButtonEvent::None) {
+            TEST_ASSERT_TRUE(receivedCount < maxReceived);
+            received[receivedCount].event = event;
+            received[receivedCount].time = t;
+            receivedCount++;
+        }
+    }
+}
+
+static void assertEvents(const ButtonEvent* expected, uint8_t length) {
+    TEST_ASSERT_EQUAL_UINT8(length, receivedCount);
+    for (uint8_t i = 0; i < length; i++) {
+        TEST_ASSERT_EQUAL_INT((int)expected[i], (int)received[i].event);
+    }
+}
+
+void test_short_press(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = { {1000, true}, {1100, false} };
+    replay(button, script, 2, 2000);
+
+    const ButtonEvent expected[] = { ButtonEvent::ShortPress };
+    assertEvents(expected, 1);
+    TEST_ASSERT_EQUAL_UINT32(1151, received[0].time);   // Relâchement validé après l'anti-rebond
+}
+
+void test_bounces_are_absorbed(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = {
+        {1000, true}, {1004, false}, {1009, true},
+        {1150, false}, {1153, true}, {1157, false}
+    };
+    replay(button, script, 6, 2000);
+
+    const ButtonEvent expected[] = { ButtonEvent::ShortPress };
+    assertEvents(expected, 1);
+}
+
+void test_glitch_shorter_than_debounce_is_ignored(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = { {1000, true}, {1020, false} };
+    replay(button, script, 2, 2000);
+    TEST_ASSERT_EQUAL_UINT8(0, receivedCount);
+}
+
+void test_long_press_with_repeats(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = { {1000, true}, {2500, false} };
+    replay(button, script, 2, 3000);
+
+    const ButtonEvent expected[] = {
+        ButtonEvent::LongPressStart, ButtonEvent::HoldRepeat, ButtonEvent::HoldRepeat,
+        ButtonEvent::HoldRepeat, ButtonEvent::LongPressEnd
+    };
+    assertEvents(expected, 5);
+    TEST_ASSERT_EQUAL_UINT32(1800, received[0].time);
+    TEST_ASSERT_EQUAL_UINT32(2000, received[1].time);
+    TEST_ASSERT_EQUAL_UINT32(2200, received[2].time);
+    TEST_ASSERT_EQUAL_UINT32(2400, received[3].time);
+    TEST_ASSERT_EQUAL_UINT32(2551, received[4].time);
+}
+
+void test_double_click(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = { {1000, true}, {1100, false}, {1300, true}, {1400, false} };
+    replay(button, script, 4, 2000);
+
+    const ButtonEvent expected[] = { ButtonEvent::ShortPress, ButtonEvent::ShortPress, ButtonEvent::DoubleClick };
+    assertEvents(expected, 3);
+}
+
+void test_slow_second_click_is_not_double(void) {
+    ButtonHandler button(2);
+    const ButtonEdge script[] = { {1000, true}, {1100, false}, {1500, true}, {1600, false} };
+    replay(button, script, 4, 2000);
+
+    const ButtonEvent expected[] = { ButtonEvent::ShortPress, ButtonEvent::ShortPress };
+    assertEvents(expected, 2);
+}
+
+// Boucle bloquée pendant tout l'appui : les fronts horodatés suffisent à classer l'appui
+void test_edges_replayed_late_keep_their_timing(void) {
+    ButtonHandler button(2);
+    button.onEdge(1000, true);
+    button.onEdge(1100, false);
+    button.onEdge(2000, true);
+    button.onEdge(3000, false);
+    simSetTimeMicros(5000000);
+
+    ButtonEvent events[4];
+    uint8_t count = 0;
+    ButtonEvent event;
+    while (count < 4 && (event = button.update()) != ButtonEvent::None) {
+        events[count++] = event;
+    }
+    TEST_ASSERT_EQUAL_UINT8(3, count);
+    TEST_ASSERT_EQUAL_INT((int)ButtonEvent::ShortPress, (int)events[0]);
+    TEST_ASSERT_EQUAL_INT((int)ButtonEvent::LongPressStart, (int)events[1]);
+    TEST_ASSERT_EQUAL_INT((int)ButtonEvent::LongPressEnd, (int)events[2]);
+}
+
+void test_next_deadline_follows_state(void) {
+    ButtonHandler button(2);
+    unsigned long deadline;
+    TEST_ASSERT_FALSE(button.nextDeadline(deadline));
+
+    simSetTimeMicros(1000000);
+    button.onEdge(1000, true);
+    TEST_ASSERT_TRUE(button.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(1000, deadline);           // Front à traiter tout de suite
+
+    button.update();
+    TEST_ASSERT_TRUE(button.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(1051, deadline);           // Fin de l'anti-rebond
+
+    simSetTimeMicros(1051000);
+    button.update();
+    TEST_ASSERT_TRUE(button.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(1800, deadline);           // Début de l'appui long
+
+    simSetTimeMicros(1800000);
+    TEST_ASSERT_EQUAL_INT((int)ButtonEvent::LongPressStart, (int)button.update());
+    TEST_ASSERT_TRUE(button.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(2000, deadline);           // Première répétition
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_short_press);
+    RUN_TEST(test_bounces_are_absorbed);
+    RUN_TEST(test_glitch_shorter_than_debounce_is_ignored);
+    RUN_TEST(test_long_press_with_repeats);
+    RUN_TEST(test_double_click);
+    RUN_TEST(test_slow_second_click_is_not_double);
+    RUN_TEST(test_edges_replayed_late_keep_their_timing);
+    RUN_TEST(test_next_deadline_follows_state);
+    return UNITY_END();
+}
\ No newline at end of file
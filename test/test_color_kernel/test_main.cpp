@@ -0,0 +1,91 @@
+// Noyau HSV → RGB comparé à Adafruit_NeoPixel::ColorHSV() (pio test -e native)
+
+#include <unity.h>
+#include <Adafruit_NeoPixel.h>
+#include "LedConfig.h"
+#include "ColorKernel.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Couleur d'un pixel du tampon, dans l'encodage 0x00RRGGBB de ColorHSV()
+static uint32_t pixelColor(const uint8_t* pixel) {
+    return Adafruit_NeoPixel::Color(pixel[LED_OFFSET_R], pixel[LED_OFFSET_G], pixel[LED_OFFSET_B]);
+}
+
+// Nombre d'écarts rapporté plutôt qu'un échec au premier : un message par cas serait illisible
+static void assertSame(uint16_t hue, uint8_t sat, uint8_t val, uint32_t& mismatches) {
+    uint8_t pixel[LED_BYTES_PER_PIXEL];
+    hsvToPixel(pixel, hue, sat, val);
+    if (pixelColor(pixel) != Adafruit_NeoPixel::ColorHSV(hue, sat, val)) {
+        mismatches++;
+    }
+}
+
+// Toutes les teintes, pour quelques couples saturation/valeur (secteurs et arrondi de la teinte)
+void test_every_hue(void) {
+    static const uint8_t levels[][2] = { {255, 255}, {0, 255}, {128, 200}, {255, 1}, {17, 0} };
+    uint32_t mismatches = 0;
+    for (uint8_t l = 0; l < sizeof(levels) / sizeof(levels[0]); l++) {
+        for (uint32_t hue = 0; hue <= 0xFFFF; hue++) {
+            assertSame(hue, levels[l][0], levels[l][1], mismatches);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, mismatches);
+}
+
+// Toutes les saturations et valeurs sur le secteur rouge → jaune : la composante verte y prend
+// chacune des 256 valeurs, le rouge reste à 255 et le bleu à 0. Chaque composante passe par le
+// même calcul, toutes les entrées possibles de ce calcul sont donc couvertes.
+void test_every_saturation_and_value(void) {
+    uint32_t mismatches = 0;
+    for (uint16_t h = 0; h < 256; h++) {
+        uint16_t hue = ((uint32_t)h * 65536UL + 1529) / 1530;   // Teinte qui s'arrondit à h
+        for (uint16_t sat = 0; sat < 256; sat++) {
+            for (uint16_t val = 0; val < 256; val++) {
+                assertSame(hue, sat, val, mismatches);
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, mismatches);
+}
+
+void test_ramp_span_matches_per_pixel(void) {
+    static const uint16_t count = 40;
+    uint8_t pixels[count * LED_BYTES_PER_PIXEL];
+    uint8_t val[count];
+    for (uint16_t i = 0; i < count; i++) {
+        val[i] = i * 6;
+    }
+
+    uint16_t hueStart = 60000;
+    uint32_t hueStep = 0x0123456UL;   // Teinte qui reboucle au-delà de 65535
+    hsvRampSpan(pixels, count, 1, hueStart, hueStep, 200, val);
+
+    uint32_t hue = (uint32_t)hueStart << 16;
+    for (uint16_t i = 0; i < count; i++) {
+        TEST_ASSERT_EQUAL_HEX32(Adafruit_NeoPixel::ColorHSV(hue >> 16, 200, val[i]),
+                                pixelColor(pixels + i * LED_BYTES_PER_PIXEL));
+        hue += hueStep;
+    }
+}
+
+void test_reverse_ramp_fills_backwards(void) {
+    uint8_t pixels[4 * LED_BYTES_PER_PIXEL];
+    const uint8_t val[] = {255, 255, 255, 255};
+    hsvRampSpan(pixels + 3 * LED_BYTES_PER_PIXEL, 4, -1, 0, (uint32_t)21845 << 16, 255, val);
+
+    TEST_ASSERT_EQUAL_HEX32(Adafruit_NeoPixel::ColorHSV(0), pixelColor(pixels + 3 * LED_BYTES_PER_PIXEL));
+    TEST_ASSERT_EQUAL_HEX32(Adafruit_NeoPixel::ColorHSV(21845), pixelColor(pixels + 2 * LED_BYTES_PER_PIXEL));
+    TEST_ASSERT_EQUAL_HEX32(Adafruit_NeoPixel::ColorHSV(43690), pixelColor(pixels + LED_BYTES_PER_PIXEL));
+    TEST_ASSERT_EQUAL_HEX32(Adafruit_NeoPixel::ColorHSV(65535), pixelColor(pixels));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_every_hue);
+    RUN_TEST(test_every_saturation_and_value);
+    RUN_TEST(test_ramp_span_matches_per_pixel);
+    RUN_TEST(test_reverse_ramp_fills_backwards);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+// Échéances de réveil de FrameScheduler (pio test -e native)
+
+#include <unity.h>
+#include <Arduino.h>
+#include <Adafruit_NeoPixel.h>
+#include "SimHost.h"
+#include "LedConfig.h"
+#include "ParameterBank.h"
+#include "FrameScheduler.h"
+#include "OffMode.h"
+#include "WhiteMode.h"
+#include "GradientMode.h"
+
+static const uint8_t testFps = 50;
+static const unsigned long testInterval = 1000 / testFps;
+
+static Adafruit_NeoPixel* strip;
+static ParameterBank* parameters;
+
+void setUp(void) {
+    simSetTimeMicros(0);
+    simSetShowTimeModel(false);
+    simSetSerialEcho(false);
+    strip = new Adafruit_NeoPixel(LED_COUNT, 6, LED_TYPE);
+    strip->begin();
+    parameters = new ParameterBank();
+}
+
+void tearDown(void) {
+    delete parameters;
+    delete strip;
+}
+
+// Avance l'horloge virtuelle jusqu'à l'instant t (millis)
+static void advanceTo(unsigned long t) {
+    simSetTimeMicros((uint64_t)t * 1000);
+}
+
+void test_first_frame_is_immediate(void) {
+    FrameScheduler scheduler(strip, testFps);
+    OffMode off(strip, parameters);
+    TEST_ASSERT_EQUAL_UINT32(0, scheduler.wakeTime(&off));
+    TEST_ASSERT_TRUE(scheduler.update(&off));
+}
+
+void test_animated_mode_wakes_every_slot(void) {
+    FrameScheduler scheduler(strip, testFps);
+    GradientMode gradient(strip, parameters);
+    for (unsigned long t = 0; t < 200; t += testInterval) {
+        advanceTo(t);
+        TEST_ASSERT_TRUE(scheduler.update(&gradient));
+        TEST_ASSERT_EQUAL_UINT32(t + testInterval, scheduler.wakeTime(&gradient));
+    }
+}
+
+void test_static_mode_waits_for_refresh(void) {
+    FrameScheduler scheduler(strip, testFps);
+    OffMode off(strip, parameters);
+    TEST_ASSERT_TRUE(scheduler.update(&off));
+
+    // Image fixe : prochaine trame au rafraîchissement périodique
+    TEST_ASSERT_EQUAL_UINT32(1000, scheduler.wakeTime(&off));
+    advanceTo(999);
+    TEST_ASSERT_FALSE(scheduler.update(&off));
+    advanceTo(1000);
+    TEST_ASSERT_TRUE(scheduler.update(&off));
+    TEST_ASSERT_EQUAL_UINT32(2000, scheduler.wakeTime(&off));
+}
+
+void test_pending_parameter_wakes_next_slot(void) {
+    FrameScheduler scheduler(strip, testFps);
+    WhiteMode white(strip, parameters);
+    TEST_ASSERT_TRUE(scheduler.update(&white));
+    TEST_ASSERT_EQUAL_UINT32(1000, scheduler.wakeTime(&white));
+
+    // Paramètre modifié : le mode redevient à rendre au créneau suivant
+    parameters->set(PARAM_GLOBAL, 80.0);
+    TEST_ASSERT_EQUAL_UINT32(testInterval, scheduler.wakeTime(&white));
+}
+
+void test_continuous_input_wakes_next_slot(void) {
+    FrameScheduler scheduler(strip, testFps);
+    WhiteMode white(strip, parameters);
+    TEST_ASSERT_TRUE(scheduler.update(&white));
+
+    // Mode au repos, mais entrée évoluant hors du mode : pas de veille au-delà du créneau
+    TEST_ASSERT_EQUAL_UINT32(testInterval, scheduler.wakeTime(&white, true));
+    TEST_ASSERT_EQUAL_UINT32(1000, scheduler.wakeTime(&white, false));
+}
+
+// Boucle de main.cpp pendant un appui long : le paramètre change à chaque tour, puis trame,
+// puis veille jusqu'au réveil. Retourne le nombre de trames produites en une seconde.
+static unsigned long framesWhileAdjusting(bool continuous) {
+    FrameScheduler scheduler(strip, testFps);
+    WhiteMode white(strip, parameters);
+    unsigned long frames = 0;
+    unsigned long now = 0;
+    float value = 0.0;
+
+    while (now < 1000) {
+        advanceTo(now);
+        value += 1.0;
+        parameters->set(PARAM_GLOBAL, value);
+        if (scheduler.update(&white)) {
+            frames++;
+        }
+        unsigned long wake = scheduler.wakeTime(&white, continuous);
+        // Répétition du bouton (HoldRepeat) toutes les 200 ms : seule autre échéance
+        unsigned long buttonTime = (now / 200 + 1) * 200;
+        now = (long)(wake - buttonTime) > 0 ? buttonTime : wake;
+    }
+    return frames;
+}
+
+void test_long_press_keeps_frame_rate(void) {
+    TEST_ASSERT_EQUAL_UINT32(testFps, framesWhileAdjusting(true));
+}
+
+void test_long_press_without_continuous_falls_back_to_button_rate(void) {
+    // Sans l'indication, un mode au repos ne réveille plus la boucle : seule la répétition du bouton
+    // le fait (5 Hz). main.cpp passe donc isAdjustingParameter.
+    TEST_ASSERT_EQUAL_UINT32(5, framesWhileAdjusting(false));
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_is_immediate);
+    RUN_TEST(test_animated_mode_wakes_every_slot);
+    RUN_TEST(test_static_mode_waits_for_refresh);
+    RUN_TEST(test_pending_parameter_wakes_next_slot);
+    RUN_TEST(test_continuous_input_wakes_next_slot);
+    RUN_TEST(test_long_press_keeps_frame_rate);
+    RUN_TEST(test_long_press_without_continuous_falls_back_to_button_rate);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+// Erreur des accesseurs de LookupTables.h par rapport à math.h (pio test -e native).
+// Mêmes bornes que tools/generate_lookup_tables.py, vérifiées ici sur le code C++ lui-même.
+
+#include <unity.h>
+#include <math.h>
+#include "LookupTables.h"
+
+static const double maxSinError = 0.0005;
+static const double maxPowError = 0.0035;
+static const double gammaExponent = 2.6;   // GAMMA du générateur
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_sin16_error_bound(void) {
+    double worst = 0.0;
+    for (uint32_t phase = 0; phase <= 0xFFFF; phase++) {
+        double error = fabs(lutSin16(phase) / 32767.0 - sin(2.0 * M_PI * phase / 65536.0));
+        if (error > worst) {
+            worst = error;
+        }
+    }
+    TEST_ASSERT_TRUE_MESSAGE(worst <= maxSinError, "erreur de lutSin16() hors borne");
+}
+
+void test_sin_unit_is_shifted_sin16(void) {
+    for (uint32_t phase = 0; phase <= 0xFFFF; phase++) {
+        TEST_ASSERT_EQUAL_UINT16((uint16_t)(lutSin16(phase) + 32768), lutSinUnit(phase));
+    }
+    TEST_ASSERT_EQUAL_UINT16(32768, lutSinUnit(0));
+    TEST_ASSERT_TRUE(lutSinUnit(16384) >= UNIT_ONE - 1);
+    TEST_ASSERT_TRUE(lutSinUnit(49152) <= 1);
+}
+
+// Tous les exposants tabulés et interpolés de [1.5, 4.0], x parcouru par pas premier
+void test_pow_unit_error_bound(void) {
+    double worst = 0.0;
+    for (q8_8_t k = LUT_POW_K_MIN; k <= LUT_POW_K_MAX; k++) {
+        for (uint32_t x = 0; x <= UNIT_ONE; x += 7) {
+            double expected = pow(x / 65535.0, k / 256.0);
+            double error = fabs(lutPowUnit(x, k) / 65535.0 - expected);
+            if (error > worst) {
+                worst = error;
+            }
+        }
+    }
+    TEST_ASSERT_TRUE_MESSAGE(worst <= maxPowError, "erreur de lutPowUnit() hors borne");
+}
+
+// 0 est exact ; 1 reste dans la borne (interpolation sur le dernier segment, sans atteindre son bout)
+void test_pow_unit_end_points(void) {
+    for (q8_8_t k = LUT_POW_K_MIN; k <= LUT_POW_K_MAX; k++) {
+        TEST_ASSERT_EQUAL_UINT16(0, lutPowUnit(0, k));
+        TEST_ASSERT_TRUE(UNIT_ONE - lutPowUnit(UNIT_ONE, k) <= maxPowError * 65535.0);
+    }
+}
+
+void test_pow_unit_falls_back_outside_table(void) {
+    static const q8_8_t outside[] = {256, LUT_POW_K_MIN - 1, LUT_POW_K_MAX + 1, 1280};
+    for (uint8_t i = 0; i < sizeof(outside) / sizeof(outside[0]); i++) {
+        for (uint32_t x = 0; x <= UNIT_ONE; x += 257) {
+            TEST_ASSERT_EQUAL_UINT16(powUnit(x, outside[i]), lutPowUnit(x, outside[i]));
+        }
+    }
+}
+
+void test_gamma_table_matches_curve(void) {
+    for (uint16_t i = 0; i < 256; i++) {
+        TEST_ASSERT_EQUAL_UINT8((uint8_t)(pow(i / 255.0, gammaExponent) * 255.0 + 0.5), lutGamma8(i));
+    }
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sin16_error_bound);
+    RUN_TEST(test_sin_unit_is_shifted_sin16);
+    RUN_TEST(test_pow_unit_error_bound);
+    RUN_TEST(test_pow_unit_end_points);
+    RUN_TEST(test_pow_unit_falls_back_outside_table);
+    RUN_TEST(test_gamma_table_matches_curve);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,98 @@
+// File d'échéances TimerQueue et rebouclage de millis() (pio test -e native)
+
+#include <unity.h>
+#include "TimerQueue.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_time_reached_across_wrap(void) {
+    TEST_ASSERT_TRUE(timeReached(100, 100));
+    TEST_ASSERT_FALSE(timeReached(99, 100));
+    TEST_ASSERT_TRUE(timeReached(5, 0xFFFFFFF0UL));
+    TEST_ASSERT_FALSE(timeReached(0xFFFFFFF0UL, 5));
+}
+
+void test_poll_returns_deadlines_in_order(void) {
+    TimerPool<4> timers;
+    TEST_ASSERT_TRUE(timers.schedule(1, 300));
+    TEST_ASSERT_TRUE(timers.schedule(2, 100));
+    TEST_ASSERT_TRUE(timers.schedule(3, 200));
+
+    uint32_t deadline;
+    TEST_ASSERT_TRUE(timers.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(100, deadline);
+
+    uint8_t id;
+    TEST_ASSERT_FALSE(timers.poll(99, id));
+    TEST_ASSERT_TRUE(timers.poll(250, id));
+    TEST_ASSERT_EQUAL_UINT8(2, id);
+    TEST_ASSERT_TRUE(timers.poll(250, id));
+    TEST_ASSERT_EQUAL_UINT8(3, id);
+    TEST_ASSERT_FALSE(timers.poll(250, id));
+    TEST_ASSERT_TRUE(timers.poll(300, id));
+    TEST_ASSERT_EQUAL_UINT8(1, id);
+    TEST_ASSERT_FALSE(timers.nextDeadline(deadline));
+}
+
+void test_reschedule_replaces_and_cancel_removes(void) {
+    TimerPool<2> timers;
+    TEST_ASSERT_TRUE(timers.schedule(1, 100));
+    TEST_ASSERT_TRUE(timers.schedule(2, 200));
+    TEST_ASSERT_TRUE(timers.schedule(1, 300));
+    TEST_ASSERT_EQUAL_UINT8(2, timers.size());
+
+    uint8_t id;
+    TEST_ASSERT_TRUE(timers.poll(1000, id));
+    TEST_ASSERT_EQUAL_UINT8(2, id);
+
+    timers.cancel(1);
+    TEST_ASSERT_FALSE(timers.pending(1));
+    TEST_ASSERT_FALSE(timers.poll(1000, id));
+}
+
+void test_full_queue_rejects(void) {
+    TimerPool<2> timers;
+    TEST_ASSERT_TRUE(timers.schedule(1, 100));
+    TEST_ASSERT_TRUE(timers.schedule(2, 200));
+    TEST_ASSERT_FALSE(timers.schedule(3, 50));
+    TEST_ASSERT_FALSE(timers.pending(3));
+}
+
+// Horloge avancée juste avant le rebouclage : les échéances programmées de part et d'autre
+// sortent dans l'ordre des instants, pas dans celui des valeurs brutes
+void test_order_kept_across_millis_wrap(void) {
+    TimerPool<3> timers;
+    uint32_t now = 0xFFFFFF00UL;
+    TEST_ASSERT_TRUE(timers.scheduleIn(1, now, 0x200));   // Après le rebouclage (0x100)
+    TEST_ASSERT_TRUE(timers.scheduleIn(2, now, 0x80));    // Avant (0xFFFFFF80)
+    TEST_ASSERT_TRUE(timers.scheduleIn(3, now, 0x180));   // Après (0x80)
+
+    uint32_t deadline;
+    TEST_ASSERT_TRUE(timers.nextDeadline(deadline));
+    TEST_ASSERT_EQUAL_UINT32(0xFFFFFF80UL, deadline);
+
+    uint8_t expected[] = {2, 3, 1};
+    uint8_t fired = 0;
+    for (uint16_t step = 0; step <= 0x200; step++, now++) {
+        uint8_t id;
+        while (timers.poll(now, id)) {
+            TEST_ASSERT_TRUE(fired < sizeof(expected));
+            TEST_ASSERT_EQUAL_UINT8(expected[fired], id);
+            TEST_ASSERT_EQUAL_UINT32(timers.size(), 2 - fired);
+            fired++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8(3, fired);
+    TEST_ASSERT_EQUAL_UINT32(0x100, now - 1);
+}
+
+int main(int argc, char** argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_time_reached_across_wrap);
+    RUN_TEST(test_poll_returns_deadlines_in_order);
+    RUN_TEST(test_reschedule_replaces_and_cancel_removes);
+    RUN_TEST(test_full_queue_rejects);
+    RUN_TEST(test_order_kept_across_millis_wrap);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""Décode la télémétrie binaire de FrameProfiler (src/FrameProfiler.h).
+
+Usage :
+    python3 tools/decode_telemetry.py /dev/ttyACM0 [--baud 9600] [--request] [--plot]
+    python3 tools/decode_telemetry.py capture.bin [--plot]
+    .pio/build/native/program --duration 30 | python3 tools/decode_telemetry.py -
+
+Les trames sont recherchées dans le flux par leur synchronisation et validées par
+leur somme de Fletcher : le texte éventuellement mêlé sur le port série est ignoré.
+Un port série nécessite pyserial, --plot nécessite matplotlib.
+"""
+
+import argparse
+import struct
+import sys
+
+# Doit rester synchronisé avec les PROFILER_* de FrameProfiler.h
+SYNC = b"\xa5\x5a"
+VERSION = 1
+BUCKETS = 12
+BUCKET_SHIFT = 4
+PAYLOAD_FORMAT = "<I7H%dH" % BUCKETS
+PAYLOAD_SIZE = struct.calcsize(PAYLOAD_FORMAT)
+CHANNELS = ["loop", "render", "show", "jitter"]
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for byte in data:
+        sum1 = (sum1 + byte) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1, sum2
+
+
+def bucket_label(index):
+    low = 0 if index == 0 else 1 << (BUCKET_SHIFT + index - 1)
+    if index == BUCKETS - 1:
+        return ">=%d" % low
+    return "%d-%d" % (low, (1 << (BUCKET_SHIFT + index)) - 1)
+
+
+def parse_frames(buffer):
+    """Extrait les trames valides de buffer ; retourne (trames, octets non consommés)."""
+    frames = []
+    while True:
+        start = buffer.find(SYNC)
+        if start < 0:
+            return frames, buffer[-1:]
+        buffer = buffer[start:]
+        if len(buffer) < 5:
+            return frames, buffer
+        version, channel, length = buffer[2], buffer[3], buffer[4]
+        if version != VERSION or length != PAYLOAD_SIZE or channel >= len(CHANNELS):
+            buffer = buffer[1:]
+            continue
+        total = 5 + length + 2
+        if len(buffer) < total:
+            return frames, buffer
+        if tuple(buffer[total - 2:total]) != fletcher16(buffer[2:total - 2]):
+            buffer = buffer[1:]
+            continue
+        values = struct.unpack(PAYLOAD_FORMAT, bytes(buffer[5:5 + length]))
+        frames.append({
+            "millis": values[0],
+            "channel": CHANNELS[channel],
+            "frames": values[1],
+            "late": values[2],
+            "dropped": values[3],
+            "overruns": values[4],
+            "samples": values[5],
+            "min": values[6],
+            "max": values[7],
+            "buckets": list(values[8:]),
+        })
+        buffer = buffer[total:]
+
+
+def print_frame(frame):
+    histogram = " ".join("%s:%d" % (bucket_label(i), n) for i, n in enumerate(frame["buckets"]) if n)
+    print("%10d %-6s frames=%d late=%d dropped=%d overruns=%d n=%d min=%dus max=%dus | %s" % (
+        frame["millis"], frame["channel"], frame["frames"], frame["late"], frame["dropped"],
+        frame["overruns"], frame["samples"], frame["min"], frame["max"], histogram))
+
+
+def plot(frames):
+    import matplotlib.pyplot as plt
+
+    figure, axes = plt.subplots(len(CHANNELS), 1, figsize=(10, 2.5 * len(CHANNELS)))
+    for axis, name in zip(axes, CHANNELS):
+        totals = [0] * BUCKETS
+        for frame in frames:
+            if frame["channel"] == name:
+                totals = [a + b for a, b in zip(totals, frame["buckets"])]
+        axis.bar(range(BUCKETS), totals)
+        axis.set_xticks(range(BUCKETS))
+        axis.set_xticklabels([bucket_label(i) for i in range(BUCKETS)], fontsize=7)
+        axis.set_title("%s (µs)" % name)
+    figure.tight_layout()
+    plt.show()
+
+
+def open_source(path, baud, request):
+    if path == "-":
+        return sys.stdin.buffer
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        import serial
+
+        port = serial.Serial(path, baud, timeout=0.5)
+        if request:
+            port.write(b"T")
+        return port
+    return open(path, "rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("source", help="port série, fichier de capture ou '-' pour l'entrée standard")
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--request", action="store_true", help="demande l'envoi immédiat des quatre canaux")
+    parser.add_argument("--plot", action="store_true", help="histogrammes cumulés à la fin de la lecture")
+    args = parser.parse_args()
+
+    source = open_source(args.source, args.baud, args.request)
+    frames = []
+    pending = b""
+    try:
+        while True:
+            chunk = source.read(256)
+            if not chunk:
+                if hasattr(source, "is_open"):
+                    continue
+                break
+            decoded, pending = parse_frames(pending + chunk)
+            for frame in decoded:
+                print_frame(frame)
+            frames.extend(decoded)
+    except KeyboardInterrupt:
+        pass
+
+    if args.plot and frames:
+        plot(frames)
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
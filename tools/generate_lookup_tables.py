@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""Génère src/LookupTablesData.cpp (tables en PROGMEM) pour src/LookupTables.h.
+
+Usage : python3 tools/generate_lookup_tables.py
+
+Les paramètres ci-dessous doivent rester synchronisés avec les constantes
+LUT_* de LookupTables.h. Après génération, le script émule les accesseurs
+entiers (interpolation comprise) et échoue si l'erreur dépasse les bornes
+fixées par rapport à math.h.
+"""
+
+import math
+import os
+import sys
+
+SINE_SIZE = 256            # Entrées pour une période complète
+POW_SEGMENTS = 64          # Segments par courbe x^k (65 points)
+POW_K_MIN = 1.5            # Premier exposant tabulé
+POW_K_STEP = 0.25          # Pas de quantification de k
+POW_K_COUNT = 11           # 1.5, 1.75, ... 4.0
+GAMMA = 2.6                # Même courbe que Adafruit_NeoPixel::gamma8()
+FIRE_ORANGE_START = 0.1    # Zones de couleur de FlameClassic (src/FlameMode.h)
+FIRE_ORANGE_END = 0.9
+
+# Bornes d'erreur absolue tolérées (sur [0, 1] pour pow, [-1, 1] pour sin)
+MAX_SIN_ERROR = 0.0005
+MAX_POW_ERROR = 0.0035     # Interpolation en x et entre deux k quantifiés
+
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src", "LookupTablesData.cpp")
+
+
+def sine_table():
+    return [int(round(math.sin(2 * math.pi * i / SINE_SIZE) * 32767)) for i in range(SINE_SIZE)]
+
+
+def pow_table():
+    rows = []
+    for c in range(POW_K_COUNT):
+        k = POW_K_MIN + c * POW_K_STEP
+        rows.append([min(65535, int(round((j / POW_SEGMENTS) ** k * 65535))) for j in range(POW_SEGMENTS + 1)])
+    return rows
+
+
+def gamma_table():
+    return [int(math.pow(i / 255.0, GAMMA) * 255.0 + 0.5) for i in range(256)]
+
+
+def unit_from_float(x):
+    return 0 if x <= 0 else (65535 if x >= 1 else int(x * 65535.0 + 0.5))
+
+
+def fire_table():
+    """Couleur de FlameMode::setLEDColorFlame() pour chaque chaleur 0-255 (même arithmétique entière)."""
+    start = unit_from_float(FIRE_ORANGE_START)
+    end = unit_from_float(FIRE_ORANGE_END)
+    red_scale = (255 << 16) // start
+    orange_scale = (150 << 16) // (end - start)
+    rows = []
+    for heat in range(256):
+        force = heat * 257
+        brightness = force >> 8
+        if force >= end:
+            r, g, b = 255, 255, (200 * (65535 - force)) >> 16
+        elif force >= start:
+            r, g, b = 255, ((force - start) * orange_scale) >> 16, 0
+        else:
+            r, g, b = (force * red_scale) >> 16, 0, 0
+        rows.append([(c * (brightness + 1)) >> 8 for c in (r, g, b)])
+    return rows
+
+
+def format_rows(values, per_line, indent="    "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def render(sine, pow_rows, gamma, fire):
+    out = []
+    out.append("// Fichier généré par tools/generate_lookup_tables.py : ne pas modifier à la main")
+    out.append('#include "LookupTables.h"')
+    out.append("")
+    out.append("// sin(2π * i / %d) en Q1.15" % SINE_SIZE)
+    out.append("const int16_t lutSineTable[LUT_SINE_SIZE] PROGMEM = {")
+    out.append(format_rows(sine, 8))
+    out.append("};")
+    out.append("")
+    out.append("// (j / %d)^k en fraction 16 bits, une ligne par exposant k = %.2f + %.2f * ligne"
+               % (POW_SEGMENTS, POW_K_MIN, POW_K_STEP))
+    out.append("const uint16_t lutPowTable[LUT_POW_K_COUNT][LUT_POW_POINTS] PROGMEM = {")
+    for c, row in enumerate(pow_rows):
+        out.append("    // k = %.2f" % (POW_K_MIN + c * POW_K_STEP))
+        out.append("    {")
+        out.append(format_rows(row, 9, "        "))
+        out.append("    },")
+    out.append("};")
+    out.append("")
+    out.append("// Correction gamma %.1f sur 8 bits" % GAMMA)
+    out.append("const uint8_t lutGammaTable[256] PROGMEM = {")
+    out.append(format_rows(gamma, 16))
+    out.append("};")
+    out.append("")
+    out.append("// Palette de FireMode : couleurs de FlameMode (zones rouge, orange et blanche à %.2f et %.2f)"
+               % (FIRE_ORANGE_START, FIRE_ORANGE_END))
+    out.append("// pour chaque chaleur, en {r, g, b}")
+    out.append("const uint8_t lutFireTable[256][3] PROGMEM = {")
+    for i in range(0, 256, 4):
+        out.append("    " + " ".join("{%d, %d, %d}," % tuple(rgb) for rgb in fire[i:i + 4]))
+    out.append("};")
+    return "\n".join(out)
+
+
+# Émulation des accesseurs entiers de LookupTables.h
+
+def emulate_sin(sine, phase):
+    i = phase >> 8
+    a = sine[i]
+    b = sine[(i + 1) & 0xFF]
+    return a + (((b - a) * (phase & 0xFF)) >> 8)
+
+
+def emulate_curve(row, x):
+    i = x >> 10
+    a = row[i]
+    b = row[i + 1]
+    return a + (((b - a) * (x & 0x3FF)) >> 10)
+
+
+def emulate_pow(pow_rows, x, k):
+    offset = k - int(POW_K_MIN * 256)
+    curve = offset >> 6
+    frac = offset & 63
+    a = emulate_curve(pow_rows[curve], x)
+    if frac == 0:
+        return a
+    b = emulate_curve(pow_rows[curve + 1], x)
+    return a + (((b - a) * frac) >> 6)
+
+
+def check(sine, pow_rows):
+    sin_error = max(abs(emulate_sin(sine, p) / 32767.0 - math.sin(2 * math.pi * p / 65536))
+                    for p in range(0, 65536, 3))
+    k_min = int(POW_K_MIN * 256)
+    k_max = int((POW_K_MIN + (POW_K_COUNT - 1) * POW_K_STEP) * 256)
+    pow_error = 0.0
+    for k in range(k_min, k_max + 1, 8):
+        for x in range(0, 65536, 97):
+            err = abs(emulate_pow(pow_rows, x, k) / 65535.0 - (x / 65535.0) ** (k / 256.0))
+            pow_error = max(pow_error, err)
+    print("sin : erreur max %.6f (borne %.6f)" % (sin_error, MAX_SIN_ERROR))
+    print("pow : erreur max %.6f (borne %.6f)" % (pow_error, MAX_POW_ERROR))
+    return sin_error <= MAX_SIN_ERROR and pow_error <= MAX_POW_ERROR
+
+
+def main():
+    sine = sine_table()
+    pow_rows = pow_table()
+    gamma = gamma_table()
+    fire = fire_table()
+    with open(OUTPUT, "w") as f:
+        f.write(render(sine, pow_rows, gamma, fire))
+    print("Écrit %s" % os.path.normpath(OUTPUT))
+    if not check(sine, pow_rows):
+        print("Erreur d'interpolation hors bornes", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())